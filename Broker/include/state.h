@@ -0,0 +1,81 @@
+#ifndef state_h
+#define state_h
+
+#include <atomic>
+#include <cstdint>
+
+// broker settings
+#define MAX_DEVICES 8
+#define MAX_MIXERS 16
+#define MAX_VOLUME 1023                 // highest volume level sent by the sound mixer
+#define SHARED_STATE_MAGIC 0x534d5852   // "SMXR", set once the shared memory is initialized
+#define DEFAULT_SHARED_MEMORY_NAME "/soundmixer"
+#define DEFAULT_SOCKET_NAME "soundmixer.sock"
+
+// latest state of a single sound mixer in the shared memory, guarded by a seqlock
+// the broker is the only writer, the sequence is odd while it updates the slot
+// readers retry until they read the same even sequence before and after copying the slot
+struct DeviceSlot
+{
+  std::atomic<uint32_t> sequence;
+  std::atomic<uint8_t> connected;
+  std::atomic<uint8_t> numMixers;
+  std::atomic<uint16_t> volumes[MAX_MIXERS]; // from 0 to MAX_VOLUME, muted mixers are 0
+  std::atomic<uint64_t> updateTime;          // CLOCK_MONOTONIC in nanoseconds
+};
+
+// layout of the shared memory, readers map it read-only
+struct SharedState
+{
+  std::atomic<uint32_t> magic;
+  std::atomic<uint32_t> numDevices;
+  DeviceSlot devices[MAX_DEVICES];
+};
+
+// plain copy of a device slot
+struct DeviceState
+{
+  bool connected = false;
+  uint8_t numMixers = 0;
+  uint16_t volumes[MAX_MIXERS] = {};
+  uint64_t updateTime = 0;
+};
+
+// publishes a device state, only called by the broker
+inline void writeDeviceState(DeviceSlot &slot, const DeviceState &state)
+{
+  uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  slot.sequence.store(sequence + 1, std::memory_order_relaxed); // Readers now retry
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.connected.store(state.connected, std::memory_order_relaxed);
+  slot.numMixers.store(state.numMixers, std::memory_order_relaxed);
+  for (uint8_t i = 0; i < MAX_MIXERS; i++)
+  {
+    slot.volumes[i].store(state.volumes[i], std::memory_order_relaxed);
+  }
+  slot.updateTime.store(state.updateTime, std::memory_order_relaxed);
+  slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// reads a consistent copy of a device state, never blocks the broker
+inline DeviceState readDeviceState(const DeviceSlot &slot)
+{
+  DeviceState state;
+  uint32_t before, after;
+  do
+  {
+    before = slot.sequence.load(std::memory_order_acquire);
+    state.connected = slot.connected.load(std::memory_order_relaxed);
+    state.numMixers = slot.numMixers.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < MAX_MIXERS; i++)
+    {
+      state.volumes[i] = slot.volumes[i].load(std::memory_order_relaxed);
+    }
+    state.updateTime = slot.updateTime.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = slot.sequence.load(std::memory_order_relaxed);
+  } while ((before & 1) || before != after); // The broker wrote the slot while it was copied
+  return state;
+}
+
+#endif // state_h
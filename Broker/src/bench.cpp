@@ -0,0 +1,374 @@
+/* SoundMixer broker benchmark
+ * Starts the broker on a pty that acts as a fake sound mixer and connects many subscribers to it.
+ * The fake device sends volume lines at a fixed rate, mixer 0 counts up with every line.
+ * Fast subscribers read everything and measure the latency from the write to the pty until they get the delta,
+ * slow subscribers don't read while lines are sent, they must not hold back the device or the fast subscribers.
+ * Afterwards half of the slow subscribers drain their queue, they must catch up with exactly one fresh keyframe.
+ * Then the shared memory snapshot is checked against the last line and its read time is measured.
+ * At the end the fake device is unplugged, the other slow subscribers missed its X while their queue was full,
+ * so after draining they must get the X with their resync instead of a keyframe.
+ */
+
+#include "state.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MIXERS 5
+
+struct Subscriber
+{
+  int fd;
+  bool slow;
+  bool drainAfterUnplug = false; // Slow subscriber that resyncs after the device is gone
+  std::string lineBuffer;
+  uint32_t deltas = 0;
+  uint32_t keyframes = 0;
+  int32_t lastValue = -1; // Last volume of mixer 0, from a keyframe or delta
+  bool disconnected = false;
+};
+
+static uint64_t monotonicTime()
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+static int connectSubscriber(const std::string &path, bool slow)
+{
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (slow) // Keep the socket buffer small, so the broker has to queue for this subscriber
+  {
+    int size = 1024;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+  }
+  if (connect(fd, (sockaddr *)&address, sizeof(address)) != 0)
+  {
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  return fd;
+}
+
+// reads everything the subscriber has received, latencies of deltas are added if sendTimes is given
+// returns false if nothing was received
+static bool readSubscriber(Subscriber &subscriber, const std::vector<uint64_t> *sendTimes, std::vector<uint64_t> &latencies)
+{
+  char buffer[4096];
+  ssize_t received;
+  bool receivedAny = false;
+  while ((received = recv(subscriber.fd, buffer, sizeof(buffer), 0)) > 0)
+  {
+    receivedAny = true;
+    uint64_t now = monotonicTime();
+    for (ssize_t j = 0; j < received; j++)
+    {
+      if (buffer[j] != '\n')
+      {
+        subscriber.lineBuffer += buffer[j];
+        continue;
+      }
+      const std::string &line = subscriber.lineBuffer;
+      if (line.compare(0, 4, "K 0 ") == 0)
+      {
+        subscriber.keyframes++;
+        subscriber.lastValue = atoi(line.c_str() + 4);
+        subscriber.disconnected = false;
+      }
+      else if (line == "X 0")
+      {
+        subscriber.disconnected = true;
+      }
+      else if (line.compare(0, 6, "D 0 0=") == 0)
+      {
+        subscriber.deltas++;
+        uint16_t value = atoi(line.c_str() + 6);
+        subscriber.lastValue = value;
+        if (sendTimes && value <= MAX_VOLUME && (*sendTimes)[value] != 0)
+          latencies.push_back(now - (*sendTimes)[value]);
+      }
+      subscriber.lineBuffer.clear();
+    }
+  }
+  return receivedAny;
+}
+
+// reads the slow subscribers that resync before or after the device is unplugged for half a second
+static void drainSlowSubscribers(std::vector<Subscriber> &subscribers, bool afterUnplug, std::vector<uint64_t> &latencies)
+{
+  uint64_t drainEndTime = monotonicTime() + 500000000ull;
+  while (monotonicTime() < drainEndTime)
+  {
+    bool receivedAny = false;
+    for (Subscriber &subscriber : subscribers)
+    {
+      if (subscriber.slow && subscriber.drainAfterUnplug == afterUnplug && readSubscriber(subscriber, nullptr, latencies))
+        receivedAny = true;
+    }
+    if (!receivedAny)
+      usleep(1000);
+  }
+}
+
+static uint64_t percentile(std::vector<uint64_t> &values, double fraction)
+{
+  if (values.empty())
+    return 0;
+  size_t index = std::min(values.size() - 1, (size_t)(values.size() * fraction));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+static void usage(const char *program)
+{
+  fprintf(stderr,
+          "usage: %s [-b broker] [-n subscribers] [-s slow subscribers] [-r lines per second] [-d seconds]\n"
+          "  defaults: -b ./soundmixer-broker -n 300 -s 30 -r 1000 -d 5\n",
+          program);
+}
+
+int main(int argc, char **argv)
+{
+  const char *brokerPath = "./soundmixer-broker";
+  int numSubscribers = 300;
+  int numSlowSubscribers = 30;
+  int linesPerSecond = 1000;
+  int duration = 5;
+  int option;
+  while ((option = getopt(argc, argv, "b:n:s:r:d:h")) != -1)
+  {
+    switch (option)
+    {
+    case 'b': brokerPath = optarg; break;
+    case 'n': numSubscribers = atoi(optarg); break;
+    case 's': numSlowSubscribers = atoi(optarg); break;
+    case 'r': linesPerSecond = atoi(optarg); break;
+    case 'd': duration = atoi(optarg); break;
+    default: usage(argv[0]); return option == 'h' ? 0 : 1;
+    }
+  }
+  if (numSlowSubscribers > numSubscribers || linesPerSecond <= 0 || duration <= 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  // the fake device, the broker opens the pty slave like a serial port
+  int master = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+  {
+    perror("pty");
+    return 1;
+  }
+  std::string devicePath = ptsname(master);
+  int slave = open(devicePath.c_str(), O_RDWR | O_NOCTTY); // Stays open, so the pty isn't hung up between broker reconnects
+  termios settings;
+  tcgetattr(slave, &settings);
+  cfmakeraw(&settings); // No line editing before the broker sets up the port
+  tcsetattr(slave, TCSANOW, &settings);
+
+  std::string socketPath = "/tmp/soundmixer-bench-" + std::to_string(getpid()) + ".sock";
+  std::string sharedMemoryName = "/soundmixer-bench-" + std::to_string(getpid());
+  pid_t broker = fork();
+  if (broker == 0)
+  {
+    execl(brokerPath, brokerPath, "-s", socketPath.c_str(), "-m", sharedMemoryName.c_str(), devicePath.c_str(), (char *)nullptr);
+    perror(brokerPath);
+    _exit(1);
+  }
+
+  // connect all subscribers, the broker needs a moment to create the socket
+  std::vector<Subscriber> subscribers;
+  for (int i = 0; i < numSubscribers; i++)
+  {
+    int fd = -1;
+    for (int attempt = 0; fd < 0 && attempt < 200; attempt++)
+    {
+      fd = connectSubscriber(socketPath, i < numSlowSubscribers);
+      if (fd < 0)
+        usleep(10000);
+    }
+    if (fd < 0)
+    {
+      fprintf(stderr, "can't connect to the broker\n");
+      kill(broker, SIGTERM);
+      return 1;
+    }
+    subscribers.emplace_back();
+    subscribers.back().fd = fd;
+    subscribers.back().slow = i < numSlowSubscribers;
+    subscribers.back().drainAfterUnplug = i < numSlowSubscribers && i % 2 == 1;
+  }
+
+  int epollFd = epoll_create1(EPOLL_CLOEXEC);
+  for (size_t i = 0; i < subscribers.size(); i++)
+  {
+    if (subscribers[i].slow)
+      continue;
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u64 = i;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, subscribers[i].fd, &event);
+  }
+  int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  long intervalNs = 1000000000l / linesPerSecond;
+  itimerspec interval = {{0, intervalNs}, {0, intervalNs}};
+  timerfd_settime(timerFd, 0, &interval, nullptr);
+  epoll_event timerEvent = {};
+  timerEvent.events = EPOLLIN;
+  timerEvent.data.u64 = UINT64_MAX;
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &timerEvent);
+
+  // mixer 0 counts up to MAX_VOLUME, the write time of each value is used to measure the latency
+  std::vector<uint64_t> sendTimes(MAX_VOLUME + 1, 0);
+  std::vector<uint64_t> latencies;
+  uint32_t linesSent = 0;
+  uint16_t counter = 0;
+  uint64_t endTime = monotonicTime() + (uint64_t)duration * 1000000000ull;
+  uint64_t settleTime = 0; // Keeps reading for a moment after the last line
+
+  epoll_event events[64];
+  while (settleTime == 0 || monotonicTime() < settleTime)
+  {
+    int count = epoll_wait(epollFd, events, 64, 10);
+    for (int i = 0; i < count; i++)
+    {
+      if (events[i].data.u64 == UINT64_MAX)
+      {
+        uint64_t expirations;
+        if (read(timerFd, &expirations, sizeof(expirations)) < 0 || settleTime != 0)
+          continue;
+        for (uint64_t j = 0; j < expirations; j++)
+        {
+          counter = (counter + 1) % (MAX_VOLUME + 1);
+          std::string line = std::to_string(counter) + "|1023|512|256|0\r\n";
+          sendTimes[counter] = monotonicTime();
+          if (write(master, line.data(), line.size()) == (ssize_t)line.size())
+            linesSent++;
+        }
+        if (monotonicTime() >= endTime)
+          settleTime = monotonicTime() + 200000000ull;
+        continue;
+      }
+
+      readSubscriber(subscribers[events[i].data.u64], &sendTimes, latencies);
+    }
+  }
+
+  // half of the slow subscribers now read everything queued for them, they got the first keyframe before they stopped
+  // reading, the broker dropped the deltas that didn't fit and has to follow up with a single keyframe of the last line
+  drainSlowSubscribers(subscribers, false, latencies);
+
+  // check the shared memory against the last line and measure how long a snapshot takes
+  int sharedMemoryFd = shm_open(sharedMemoryName.c_str(), O_RDONLY, 0);
+  const SharedState *sharedState = nullptr;
+  if (sharedMemoryFd >= 0)
+  {
+    void *memory = mmap(nullptr, sizeof(SharedState), PROT_READ, MAP_SHARED, sharedMemoryFd, 0);
+    if (memory != MAP_FAILED)
+      sharedState = static_cast<const SharedState *>(memory);
+    close(sharedMemoryFd);
+  }
+  bool snapshotMatches = false;
+  uint64_t snapshotTime = 0;
+  if (sharedState && sharedState->magic.load(std::memory_order_acquire) == SHARED_STATE_MAGIC)
+  {
+    DeviceState state = readDeviceState(sharedState->devices[0]);
+    snapshotMatches = state.connected && state.numMixers == BENCH_MIXERS && state.volumes[0] == counter;
+    const int reads = 1000000;
+    uint64_t start = monotonicTime();
+    uint32_t checksum = 0;
+    for (int i = 0; i < reads; i++)
+    {
+      checksum += readDeviceState(sharedState->devices[0]).volumes[0];
+    }
+    snapshotTime = (monotonicTime() - start) / reads;
+    if (checksum == 1) // Keeps the reads from being optimized away
+      printf("\n");
+  }
+
+  // unplug the device, the broker reads EIO from the pty and broadcasts the X
+  // the other slow subscribers still have a full queue, so they only get the X with their resync
+  close(master);
+  drainSlowSubscribers(subscribers, true, latencies);
+
+  kill(broker, SIGTERM);
+  waitpid(broker, nullptr, 0);
+
+  uint32_t expectedDeltas = linesSent - 1; // The first line is sent as a keyframe
+  uint32_t minDeltas = UINT32_MAX;
+  uint64_t totalDeltas = 0;
+  uint32_t completeSubscribers = 0;
+  uint32_t resyncedSubscribers = 0;
+  uint32_t unpluggedSubscribers = 0;
+  int numUnplugSubscribers = numSlowSubscribers / 2;
+  int numFastSubscribers = numSubscribers - numSlowSubscribers;
+  for (const Subscriber &subscriber : subscribers)
+  {
+    if (subscriber.drainAfterUnplug)
+    {
+      // the device was gone before the resync, so only the first keyframe and the X are expected
+      if (subscriber.keyframes == 1 && subscriber.disconnected)
+        unpluggedSubscribers++;
+      continue;
+    }
+    if (subscriber.slow)
+    {
+      // the first keyframe was queued before the slow subscriber fell behind, so exactly one more is expected
+      if (subscriber.keyframes == 2 && subscriber.lastValue == counter && !subscriber.disconnected)
+        resyncedSubscribers++;
+      continue;
+    }
+    minDeltas = std::min(minDeltas, subscriber.deltas);
+    totalDeltas += subscriber.deltas;
+    if (subscriber.deltas == expectedDeltas && subscriber.keyframes == 1)
+      completeSubscribers++;
+  }
+  if (numFastSubscribers == 0)
+    minDeltas = 0;
+
+  printf("lines sent:            %u (%d per second for %d s)\n", linesSent, linesPerSecond, duration);
+  printf("subscribers:           %d fast, %d slow\n", numFastSubscribers, numSlowSubscribers);
+  printf("deltas per subscriber: min %u, avg %.1f, expected %u\n", minDeltas,
+         numFastSubscribers ? (double)totalDeltas / numFastSubscribers : 0.0, expectedDeltas);
+  printf("complete subscribers:  %u of %d\n", completeSubscribers, numFastSubscribers);
+  printf("resynced subscribers:  %u of %d\n", resyncedSubscribers, numSlowSubscribers - numUnplugSubscribers);
+  printf("resynced after unplug: %u of %d\n", unpluggedSubscribers, numUnplugSubscribers);
+  printf("delta latency:         p50 %.1f us, p99 %.1f us, max %.1f us\n", percentile(latencies, 0.5) / 1000.0,
+         percentile(latencies, 0.99) / 1000.0, percentile(latencies, 1.0) / 1000.0);
+  printf("shared memory:         %s, %lu ns per snapshot\n", snapshotMatches ? "matches the last line" : "MISMATCH",
+         (unsigned long)snapshotTime);
+
+  for (const Subscriber &subscriber : subscribers)
+  {
+    close(subscriber.fd);
+  }
+  close(slave);
+  return snapshotMatches && completeSubscribers == (uint32_t)numFastSubscribers &&
+                 resyncedSubscribers == (uint32_t)(numSlowSubscribers - numUnplugSubscribers) &&
+                 unpluggedSubscribers == (uint32_t)numUnplugSubscribers
+             ? 0
+             : 1;
+}
@@ -0,0 +1,563 @@
+/* SoundMixer broker
+ * Owns the serial ports of one or more sound mixers and shares their volume levels with any number of processes.
+ * The latest state of every device is kept in shared memory (see state.h), which can be read without
+ * talking to the broker. Subscribers connect to a unix socket and get a keyframe followed by deltas:
+ *   K <device> <volume>|<volume>|...   full state of a device, sent on connect and after a resync
+ *   D <device> <mixer>=<volume> ...    mixers that changed since the last message
+ *   X <device>                         the device was disconnected, also sent on connect and after a resync
+ * Clients that don't keep up are never waited for. Once their buffer is full they miss the deltas
+ * and get a keyframe as soon as they have read everything that is queued.
+ */
+
+#include "state.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_CLIENT_BUFFER 16384  // bytes queued for a client before it has to resync
+#define MAX_LINE_LENGTH 256      // longer lines from a device are dropped as a whole
+#define RECONNECT_INTERVAL 1     // in seconds, disconnected devices are reopened in this interval
+#define MAX_EVENTS 64
+
+struct Device
+{
+  std::string path;
+  int fd = -1;
+  uint64_t tag = 0;          // epoll data of fd, see watch()
+  std::string lineBuffer;    // bytes of the line that is currently received
+  bool lineOverflow = false; // the current line is longer than MAX_LINE_LENGTH and is dropped at its end
+  DeviceState state;
+};
+
+struct Client
+{
+  int fd;
+  uint64_t tag;        // epoll data of fd and key in clients, see watch()
+  std::string pending; // queued messages, pending[0, offset) is already sent
+  size_t offset = 0;
+  bool waitingForWrite = false; // EPOLLOUT is enabled
+  bool resync = false;          // messages were dropped, a keyframe is sent once pending is empty
+};
+
+static int epollFd;
+static SharedState *sharedState;
+static std::vector<Device> devices;
+static std::unordered_map<uint64_t, Client> clients; // by tag
+static uint64_t nextTag = 1;
+static speed_t baudRate = B9600;
+
+static uint64_t monotonicTime()
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+static speed_t toBaudRate(long baud)
+{
+  switch (baud)
+  {
+  case 9600: return B9600;
+  case 19200: return B19200;
+  case 38400: return B38400;
+  case 57600: return B57600;
+  case 115200: return B115200;
+  default: return 0;
+  }
+}
+
+// adds fd to epoll and returns the tag its events carry
+// every fd gets a new tag, so events of a closed fd that are still in the current batch
+// can't be mistaken for a new device or client that got the same fd number
+static uint64_t watch(int fd, uint32_t events)
+{
+  epoll_event event = {};
+  event.events = events;
+  event.data.u64 = nextTag++;
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+  return event.data.u64;
+}
+
+static std::string keyframe(uint8_t deviceIndex)
+{
+  const DeviceState &state = devices[deviceIndex].state;
+  std::string message = "K " + std::to_string(deviceIndex) + " ";
+  for (uint8_t i = 0; i < state.numMixers; i++)
+  {
+    if (i > 0)
+      message += '|';
+    message += std::to_string(state.volumes[i]);
+  }
+  return message + '\n';
+}
+
+// queues the keyframes of all connected devices and an X for each disconnected one
+// a client that resyncs may have missed the X of a device that was lost while its buffer was full
+static void queueKeyframes(Client &client)
+{
+  for (uint8_t i = 0; i < devices.size(); i++)
+  {
+    if (!devices[i].state.connected)
+      client.pending += "X " + std::to_string(i) + '\n';
+    else if (devices[i].state.numMixers > 0)
+      client.pending += keyframe(i);
+  }
+}
+
+static void dropClient(Client &client)
+{
+  uint64_t tag = client.tag; // The client is destroyed by erase()
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+  close(client.fd);
+  clients.erase(tag);
+}
+
+// sends as much of the pending messages as the socket takes without blocking
+// returns false if the client was dropped
+static bool flushClient(Client &client)
+{
+  while (true)
+  {
+    while (client.offset < client.pending.size())
+    {
+      ssize_t sent = send(client.fd, client.pending.data() + client.offset, client.pending.size() - client.offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+      if (sent < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+          dropClient(client);
+          return false;
+        }
+        if (!client.waitingForWrite) // Continue once the client has read some data
+        {
+          epoll_event event = {};
+          event.events = EPOLLIN | EPOLLOUT;
+          event.data.u64 = client.tag;
+          epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &event);
+          client.waitingForWrite = true;
+        }
+        if (client.offset > client.pending.size() / 2) // Don't let the sent part grow
+        {
+          client.pending.erase(0, client.offset);
+          client.offset = 0;
+        }
+        return true;
+      }
+      client.offset += sent;
+    }
+
+    client.pending.clear();
+    client.offset = 0;
+    if (!client.resync)
+      break;
+    client.resync = false; // Everything old is sent, the client catches up with a keyframe
+    queueKeyframes(client);
+  }
+
+  if (client.waitingForWrite)
+  {
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u64 = client.tag;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &event);
+    client.waitingForWrite = false;
+  }
+  return true;
+}
+
+// sends a message to every client, clients with a full buffer are marked for a resync instead
+static void broadcast(const std::string &message)
+{
+  for (auto it = clients.begin(); it != clients.end();)
+  {
+    Client &client = (it++)->second; // flushClient() may erase the client
+    if (client.resync)
+      continue;
+    if (client.pending.size() - client.offset + message.size() > MAX_CLIENT_BUFFER)
+    {
+      client.resync = true;
+      continue;
+    }
+    bool wasEmpty = client.offset == client.pending.size();
+    client.pending += message;
+    if (wasEmpty && !client.waitingForWrite)
+      flushClient(client);
+  }
+}
+
+static void publish(uint8_t deviceIndex)
+{
+  writeDeviceState(sharedState->devices[deviceIndex], devices[deviceIndex].state);
+}
+
+// parses a line like 1023|512|0, returns the number of volume levels or 0 if the line is no volume line
+static uint8_t parseVolumeLine(const std::string &line, uint16_t *volumes)
+{
+  uint8_t count = 0;
+  uint32_t value = 0;
+  bool hasDigit = false;
+  for (char c : line)
+  {
+    if (c >= '0' && c <= '9')
+    {
+      value = value * 10 + (c - '0');
+      hasDigit = true;
+      if (value > MAX_VOLUME)
+        return 0;
+    }
+    else if (c == '|' && hasDigit && count < MAX_MIXERS - 1)
+    {
+      volumes[count++] = value;
+      value = 0;
+      hasDigit = false;
+    }
+    else if (c != '\r')
+    {
+      return 0; // Debug output of the sound mixer, like button presses
+    }
+  }
+  if (!hasDigit)
+    return 0;
+  volumes[count++] = value;
+  return count;
+}
+
+static void handleDeviceLine(uint8_t deviceIndex, const std::string &line)
+{
+  uint16_t volumes[MAX_MIXERS];
+  uint8_t count = parseVolumeLine(line, volumes);
+  if (count == 0)
+    return;
+
+  DeviceState &state = devices[deviceIndex].state;
+  state.updateTime = monotonicTime();
+  if (count != state.numMixers) // The first line of a device or a different sound mixer
+  {
+    state.numMixers = count;
+    std::copy(volumes, volumes + count, state.volumes);
+    publish(deviceIndex);
+    broadcast(keyframe(deviceIndex));
+    return;
+  }
+
+  // the sound mixer repeats its volume levels, only the changed ones are sent
+  std::string message;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (volumes[i] != state.volumes[i])
+    {
+      message += ' ' + std::to_string(i) + '=' + std::to_string(volumes[i]);
+      state.volumes[i] = volumes[i];
+    }
+  }
+  publish(deviceIndex);
+  if (!message.empty())
+    broadcast("D " + std::to_string(deviceIndex) + message + '\n');
+}
+
+static bool openDevice(uint8_t deviceIndex)
+{
+  Device &device = devices[deviceIndex];
+  int fd = open(device.path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+
+  termios settings;
+  if (tcgetattr(fd, &settings) == 0) // Not a tty if it is a fifo or file, which is read as is
+  {
+    cfmakeraw(&settings);
+    cfsetspeed(&settings, baudRate);
+    settings.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(fd, TCSANOW, &settings);
+  }
+
+  device.fd = fd;
+  device.lineBuffer.clear();
+  device.lineOverflow = false;
+  device.state.connected = true;
+  device.state.numMixers = 0; // The first line is sent as a keyframe
+  publish(deviceIndex);
+  device.tag = watch(fd, EPOLLIN);
+  fprintf(stderr, "opened %s as device %d\n", device.path.c_str(), deviceIndex);
+  return true;
+}
+
+static void closeDevice(uint8_t deviceIndex)
+{
+  Device &device = devices[deviceIndex];
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, device.fd, nullptr);
+  close(device.fd);
+  device.fd = -1;
+  device.state.connected = false;
+  publish(deviceIndex);
+  broadcast("X " + std::to_string(deviceIndex) + '\n');
+  fprintf(stderr, "lost device %d (%s), reconnecting\n", deviceIndex, device.path.c_str());
+}
+
+static void readDevice(uint8_t deviceIndex)
+{
+  Device &device = devices[deviceIndex];
+  char buffer[4096];
+  while (true)
+  {
+    ssize_t received = read(device.fd, buffer, sizeof(buffer));
+    if (received < 0 && errno == EINTR)
+      continue;
+    if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      return;
+    if (received <= 0) // Unplugged, or the other end of a pty was closed
+    {
+      closeDevice(deviceIndex);
+      return;
+    }
+    for (ssize_t i = 0; i < received; i++)
+    {
+      if (buffer[i] == '\n')
+      {
+        if (!device.lineOverflow) // A truncated line could still parse as a volume line
+          handleDeviceLine(deviceIndex, device.lineBuffer);
+        device.lineBuffer.clear();
+        device.lineOverflow = false;
+      }
+      else if (device.lineBuffer.size() < MAX_LINE_LENGTH)
+      {
+        device.lineBuffer += buffer[i];
+      }
+      else
+      {
+        device.lineOverflow = true;
+      }
+    }
+  }
+}
+
+static void acceptClients(int listenFd)
+{
+  while (true)
+  {
+    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+      return;
+    uint64_t tag = watch(fd, EPOLLIN);
+    Client &client = clients[tag];
+    client.fd = fd;
+    client.tag = tag;
+    queueKeyframes(client);
+    flushClient(client);
+  }
+}
+
+static void readClient(Client &client)
+{
+  // clients don't send anything, the socket is only read to notice when they disconnect
+  char buffer[256];
+  while (true)
+  {
+    ssize_t received = recv(client.fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (received < 0 && errno == EINTR)
+      continue;
+    if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      return;
+    if (received <= 0)
+    {
+      dropClient(client);
+      return;
+    }
+  }
+}
+
+static SharedState *createSharedState(const char *name)
+{
+  int fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+  if (fd < 0 || ftruncate(fd, sizeof(SharedState)) != 0)
+    return nullptr;
+  void *memory = mmap(nullptr, sizeof(SharedState), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory == MAP_FAILED)
+    return nullptr;
+
+  SharedState *state = static_cast<SharedState *>(memory);
+  state->numDevices.store(devices.size(), std::memory_order_relaxed);
+  for (uint8_t i = 0; i < devices.size(); i++)
+  {
+    writeDeviceState(state->devices[i], DeviceState());
+  }
+  state->magic.store(SHARED_STATE_MAGIC, std::memory_order_release);
+  return state;
+}
+
+static int createSocket(const char *path)
+{
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(address.sun_path))
+    return -1;
+  strcpy(address.sun_path, path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  unlink(path); // Remove the socket of a previous broker
+  if (fd < 0 || bind(fd, (sockaddr *)&address, sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0)
+    return -1;
+  return fd;
+}
+
+static std::string defaultSocketPath()
+{
+  const char *runtimeDir = getenv("XDG_RUNTIME_DIR");
+  return std::string(runtimeDir ? runtimeDir : "/tmp") + "/" + DEFAULT_SOCKET_NAME;
+}
+
+static void usage(const char *program)
+{
+  fprintf(stderr,
+          "usage: %s [-s socket] [-m shared memory name] [-b baud rate] device...\n"
+          "  -s  unix socket for subscribers, default $XDG_RUNTIME_DIR/" DEFAULT_SOCKET_NAME "\n"
+          "  -m  name of the shared memory, default " DEFAULT_SHARED_MEMORY_NAME "\n"
+          "  -b  baud rate of the devices, default 9600\n",
+          program);
+}
+
+int main(int argc, char **argv)
+{
+  std::string socketPath = defaultSocketPath();
+  const char *sharedMemoryName = DEFAULT_SHARED_MEMORY_NAME;
+  int option;
+  while ((option = getopt(argc, argv, "s:m:b:h")) != -1)
+  {
+    switch (option)
+    {
+    case 's': socketPath = optarg; break;
+    case 'm': sharedMemoryName = optarg; break;
+    case 'b':
+      baudRate = toBaudRate(atol(optarg));
+      if (baudRate == 0)
+      {
+        fprintf(stderr, "unsupported baud rate %s\n", optarg);
+        return 1;
+      }
+      break;
+    default: usage(argv[0]); return option == 'h' ? 0 : 1;
+    }
+  }
+  if (optind == argc || argc - optind > MAX_DEVICES)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+  for (int i = optind; i < argc; i++)
+  {
+    devices.emplace_back();
+    devices.back().path = argv[i];
+  }
+
+  sharedState = createSharedState(sharedMemoryName);
+  if (!sharedState)
+  {
+    perror("shared memory");
+    return 1;
+  }
+  int listenFd = createSocket(socketPath.c_str());
+  if (listenFd < 0)
+  {
+    perror("socket");
+    return 1;
+  }
+
+  // SIGINT and SIGTERM are handled in the event loop, so the socket and shared memory are removed
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  sigprocmask(SIG_BLOCK, &signals, nullptr);
+  int signalFd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+
+  int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  itimerspec interval = {{RECONNECT_INTERVAL, 0}, {RECONNECT_INTERVAL, 0}};
+  timerfd_settime(timerFd, 0, &interval, nullptr);
+
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  uint64_t listenTag = watch(listenFd, EPOLLIN);
+  uint64_t signalTag = watch(signalFd, EPOLLIN);
+  uint64_t timerTag = watch(timerFd, EPOLLIN);
+  for (uint8_t i = 0; i < devices.size(); i++)
+  {
+    if (!openDevice(i))
+      fprintf(stderr, "can't open %s, retrying\n", devices[i].path.c_str());
+  }
+  fprintf(stderr, "listening on %s\n", socketPath.c_str());
+
+  bool running = true;
+  epoll_event events[MAX_EVENTS];
+  while (running)
+  {
+    int count = epoll_wait(epollFd, events, MAX_EVENTS, -1);
+    for (int i = 0; i < count; i++)
+    {
+      uint64_t tag = events[i].data.u64;
+      if (tag == listenTag)
+      {
+        acceptClients(listenFd);
+      }
+      else if (tag == signalTag)
+      {
+        running = false;
+      }
+      else if (tag == timerTag)
+      {
+        uint64_t expirations;
+        if (read(timerFd, &expirations, sizeof(expirations)) < 0)
+          continue;
+        for (uint8_t j = 0; j < devices.size(); j++)
+        {
+          if (devices[j].fd < 0)
+            openDevice(j);
+        }
+      }
+      else
+      {
+        bool isDevice = false;
+        for (uint8_t j = 0; j < devices.size(); j++)
+        {
+          if (devices[j].fd >= 0 && devices[j].tag == tag)
+          {
+            readDevice(j);
+            isDevice = true;
+            break;
+          }
+        }
+        auto client = clients.find(tag);
+        if (isDevice || client == clients.end())
+          continue; // Also events of a device or client that was closed earlier in this batch
+        if (events[i].events & (EPOLLHUP | EPOLLERR))
+          dropClient(client->second);
+        else if ((events[i].events & EPOLLOUT) && !flushClient(client->second))
+          continue;
+        else if (events[i].events & EPOLLIN)
+          readClient(client->second);
+      }
+    }
+  }
+
+  unlink(socketPath.c_str());
+  shm_unlink(sharedMemoryName);
+  return 0;
+}
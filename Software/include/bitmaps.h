@@ -2,8 +2,14 @@
 #define bitmaps_h
 
 #include <avr/pgmspace.h>
+#include "defines.h"
 
-// '0', 128x40px
+// Generated by scripts/generate_bitmaps.py, do not edit by hand.
+// The animation frames and icons are compressed with PackBits and drawn with drawCompressedBitmap(),
+// unless that doesn't make a group smaller, it is then stored uncompressed for ssd1306_drawBitmap().
+
+#define ANIMATION_FRAMES_COMPRESSED false // 1935 bytes compressed from 1920
+// '0', 128x40px, 640 bytes uncompressed
 const unsigned char animationFrame0 [] PROGMEM = {
 	0x20, 0x08, 0x82, 0x24, 0x00, 0xa8, 0x02, 0x00, 0x2a, 0x80, 0x24, 0x00, 0x28, 0x00, 0x12, 0x40, 
 	0x08, 0x80, 0x12, 0x80, 0x08, 0x22, 0x80, 0x04, 0x20, 0x82, 0x20, 0x04, 0x90, 0x02, 0x48, 0x00, 
@@ -46,8 +52,7 @@ const unsigned char animationFrame0 [] PROGMEM = {
 	0x29, 0x3f, 0x13, 0x5f, 0x0e, 0x0f, 0x4d, 0x0e, 0x27, 0x03, 0xa2, 0x0b, 0x20, 0x04, 0x90, 0x02, 
 	0x20, 0x01, 0x28, 0x82, 0x10, 0x00, 0xa4, 0x09, 0x00, 0x45, 0x10, 0x82, 0x10, 0x80, 0x14, 0x00
 };
-
-// '1', 128x40px
+// '1', 128x40px, 640 bytes uncompressed
 const unsigned char animationFrame1 [] PROGMEM = {
 	0x20, 0x08, 0x82, 0x24, 0x00, 0xa8, 0x02, 0x00, 0x2a, 0x80, 0x24, 0x00, 0x28, 0x00, 0x12, 0x40, 
 	0x08, 0x80, 0x12, 0x80, 0x08, 0x22, 0x80, 0x04, 0x20, 0x82, 0x20, 0x04, 0x90, 0x02, 0x48, 0x00, 
@@ -90,8 +95,7 @@ const unsigned char animationFrame1 [] PROGMEM = {
 	0x5d, 0x1e, 0xab, 0x36, 0x19, 0x57, 0x0b, 0x8f, 0x25, 0x87, 0x13, 0x42, 0x09, 0x21, 0x04, 0x10, 
 	0x41, 0x08, 0x22, 0x10, 0x80, 0x22, 0x08, 0x82, 0x20, 0x09, 0x00, 0x52, 0x00, 0x84, 0x10, 0x05
 };
-
-// '2', 128x40px
+// '2', 128x40px, 640 bytes uncompressed
 const unsigned char animationFrame2 [] PROGMEM = {
 	0x20, 0x08, 0x82, 0x24, 0x00, 0xa8, 0x02, 0x00, 0x2a, 0x80, 0x24, 0x00, 0x28, 0x00, 0x12, 0x40, 
 	0x08, 0x80, 0x12, 0x80, 0x08, 0x22, 0x80, 0x04, 0x20, 0x82, 0x20, 0x04, 0x90, 0x02, 0x48, 0x00, 
@@ -135,16 +139,139 @@ const unsigned char animationFrame2 [] PROGMEM = {
 	0x03, 0x23, 0x81, 0x29, 0x00, 0x20, 0x8a, 0x01, 0x48, 0x02, 0x10, 0x44, 0x00, 0x44, 0x10, 0x05
 };
 
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 1968)
 const unsigned char* animationFrames_128x40[3] = {
 	animationFrame0,
 	animationFrame1,
 	animationFrame2
 };
 
+#if BITMAP_TIMING_REPORT // Only used to compare the draw time of both formats
+// '0', 128x40px, 645 bytes compressed from 640
+const unsigned char animationFrame0Compressed [] PROGMEM = {
+	0x7f, 0x20, 0x08, 0x82, 0x24, 0x00, 0xa8, 0x02, 0x00, 0x2a, 0x80, 0x24, 0x00, 0x28, 0x00, 0x12, 
+	0x40, 0x08, 0x80, 0x12, 0x80, 0x08, 0x22, 0x80, 0x04, 0x20, 0x82, 0x20, 0x04, 0x90, 0x02, 0x48, 
+	0x00, 0x22, 0x88, 0x00, 0x0a, 0x20, 0x00, 0x42, 0x08, 0x20, 0x82, 0x28, 0x00, 0x12, 0x40, 0x04, 
+	0x10, 0x42, 0x00, 0x94, 0x02, 0x20, 0x84, 0x11, 0x40, 0x04, 0x50, 0x02, 0x48, 0x00, 0x52, 0x00, 
+	0x24, 0x80, 0x2a, 0x00, 0x48, 0x02, 0x48, 0x00, 0x92, 0x24, 0x00, 0x94, 0x00, 0xa0, 0x0a, 0x00, 
+	0x24, 0x00, 0x48, 0x02, 0x48, 0x24, 0x00, 0x92, 0x00, 0x24, 0x08, 0x42, 0x00, 0x2a, 0x80, 0x0a, 
+	0xa0, 0x02, 0x88, 0x22, 0x48, 0x00, 0x0a, 0xa0, 0x04, 0x20, 0x80, 0x2a, 0x00, 0x48, 0x02, 0x50, 
+	0x04, 0xa0, 0x08, 0x42, 0x08, 0xa0, 0x0a, 0x40, 0x08, 0x22, 0x08, 0xa0, 0x0a, 0x20, 0x00, 0x2a, 
+	0x80, 0x7f, 0x50, 0x02, 0x48, 0x12, 0x00, 0x54, 0x08, 0x45, 0x10, 0x84, 0x50, 0x09, 0x82, 0x21, 
+	0x08, 0xa1, 0x04, 0x10, 0x44, 0x00, 0x52, 0x00, 0x8a, 0x20, 0x00, 0x2a, 0x00, 0x0a, 0xa0, 0x04, 
+	0x80, 0x29, 0x00, 0xa4, 0x10, 0x04, 0x41, 0x14, 0x40, 0x11, 0x04, 0x50, 0x02, 0x80, 0x51, 0x04, 
+	0x41, 0x08, 0x41, 0x04, 0x10, 0x42, 0x08, 0x00, 0x2a, 0x80, 0x21, 0x44, 0x00, 0x21, 0x84, 0x10, 
+	0x01, 0xa4, 0x00, 0x00, 0x25, 0x80, 0x12, 0x40, 0x04, 0x90, 0x22, 0x00, 0x88, 0x22, 0x00, 0x4a, 
+	0x00, 0x91, 0x04, 0x00, 0x55, 0x00, 0x22, 0x08, 0x20, 0x05, 0xa0, 0x02, 0x48, 0x21, 0x00, 0x14, 
+	0x40, 0x02, 0x28, 0x00, 0x4a, 0x01, 0x04, 0x50, 0x02, 0x88, 0x20, 0x02, 0x48, 0x00, 0x94, 0x01, 
+	0x90, 0x02, 0x88, 0x20, 0x45, 0x00, 0x90, 0x44, 0x11, 0x80, 0x55, 0x00, 0x28, 0x02, 0x20, 0x89, 
+	0x20, 0x02, 0x7f, 0x15, 0x00, 0x44, 0x11, 0x84, 0x40, 0x09, 0x20, 0x02, 0x28, 0x80, 0x02, 0x28, 
+	0x00, 0xa2, 0x08, 0x44, 0x00, 0x55, 0x00, 0x02, 0x50, 0x02, 0x00, 0xa5, 0x08, 0x41, 0x12, 0x80, 
+	0x24, 0x80, 0x92, 0xc0, 0x88, 0xc4, 0x91, 0xc0, 0x84, 0x91, 0xc4, 0x80, 0xa9, 0xe0, 0xe8, 0x72, 
+	0xd8, 0xb9, 0x6c, 0xf0, 0x55, 0xb0, 0xd2, 0xf0, 0xf5, 0x70, 0xd4, 0x38, 0x70, 0xb1, 0xd4, 0xf0, 
+	0xb2, 0x70, 0xd2, 0x38, 0x71, 0xd4, 0xb0, 0xf8, 0x52, 0xb8, 0xf0, 0xa2, 0x68, 0xe2, 0xc0, 0x89, 
+	0xc0, 0x92, 0x80, 0xa4, 0xc1, 0x48, 0xd1, 0x60, 0xa9, 0xe0, 0xb2, 0xe0, 0xb4, 0x60, 0xf1, 0xa4, 
+	0x61, 0xf0, 0x64, 0xc1, 0xd2, 0x80, 0x89, 0x20, 0x0a, 0x80, 0x24, 0x01, 0x88, 0x25, 0x80, 0x20, 
+	0x4a, 0x00, 0x04, 0x20, 0x02, 0x28, 0x02, 0x20, 0x8a, 0x00, 0x50, 0x04, 0x00, 0x29, 0x80, 0x22, 
+	0x08, 0x82, 0x10, 0x7f, 0x29, 0x00, 0x95, 0x00, 0x88, 0x02, 0x10, 0x45, 0x00, 0x8a, 0x20, 0x04, 
+	0x11, 0x40, 0x04, 0x90, 0x04, 0x21, 0x84, 0x20, 0x09, 0x80, 0x2a, 0x00, 0xb8, 0x32, 0x7e, 0x4e, 
+	0xfb, 0xd5, 0xbf, 0x76, 0xdd, 0x5f, 0xe6, 0x27, 0xf6, 0x55, 0xb7, 0xf6, 0xd7, 0xb5, 0xdf, 0xbf, 
+	0xf7, 0xae, 0xb5, 0xef, 0xd3, 0x6f, 0xd5, 0xeb, 0x96, 0xfd, 0x8b, 0xf6, 0x1e, 0xb6, 0x6f, 0x9f, 
+	0x76, 0xad, 0x37, 0xed, 0x1e, 0xee, 0x37, 0xdf, 0x35, 0xcb, 0xbe, 0xd5, 0xe7, 0x9d, 0xea, 0xd5, 
+	0xfd, 0xd3, 0xbc, 0xdb, 0xfc, 0x97, 0xfd, 0xdd, 0xbf, 0xda, 0xbf, 0x4a, 0xfd, 0xae, 0x7b, 0x9e, 
+	0x69, 0xff, 0x6b, 0xdb, 0x76, 0xd7, 0x71, 0xa1, 0xc4, 0x52, 0xc0, 0x90, 0x05, 0x50, 0x00, 0x24, 
+	0x82, 0x08, 0xa1, 0x00, 0x15, 0x00, 0x09, 0x42, 0x10, 0x80, 0x2a, 0x00, 0x41, 0x0a, 0x20, 0x00, 
+	0xaa, 0x00, 0x92, 0x00, 0x7f, 0x8a, 0x20, 0x08, 0x02, 0x50, 0x04, 0x21, 0x88, 0x02, 0x50, 0x04, 
+	0x01, 0xa8, 0x02, 0x40, 0x0a, 0x20, 0x02, 0xa8, 0x02, 0x10, 0x0a, 0x40, 0x0a, 0x20, 0x88, 0x12, 
+	0x00, 0x92, 0x40, 0x09, 0x21, 0x03, 0x52, 0x07, 0x25, 0x8a, 0x0f, 0x54, 0x1f, 0x09, 0x4f, 0x1a, 
+	0x96, 0x1a, 0x96, 0x3c, 0x26, 0x58, 0x7c, 0x30, 0x38, 0x02, 0x40, 0x09, 0x21, 0x8b, 0x03, 0x97, 
+	0x07, 0x4d, 0x0f, 0x87, 0x27, 0x01, 0x29, 0x01, 0x25, 0x81, 0x09, 0x00, 0x12, 0x40, 0x00, 0x44, 
+	0x10, 0x04, 0x40, 0x08, 0x00, 0x53, 0x0b, 0x8e, 0x0f, 0x5e, 0x1b, 0x0f, 0xad, 0x07, 0x47, 0x13, 
+	0x83, 0x2e, 0x0d, 0x5b, 0x16, 0x29, 0x3f, 0x13, 0x5f, 0x0e, 0x0f, 0x4d, 0x0e, 0x27, 0x03, 0xa2, 
+	0x0b, 0x20, 0x04, 0x90, 0x02, 0x20, 0x01, 0x28, 0x82, 0x10, 0x00, 0xa4, 0x09, 0x00, 0x45, 0x10, 
+	0x82, 0x10, 0x80, 0x14, 0x00
+};
+#endif
 
-// 'Master', 48x48px
+#define LARGE_ICONS_COMPRESSED true // 802 bytes compressed from 1440
+// 'Master', 48x48px, 144 bytes compressed from 288
 const unsigned char largeIconMaster [] PROGMEM = {
+	0x93, 0x00, 0x80, 0x80, 0x8a, 0x00, 0x03, 0x80, 0xc0, 0x80, 0x80, 0x93, 0x00, 0x06, 0x80, 0xc0, 
+	0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0x83, 0xff, 0x82, 0x00, 0x0f, 0xc0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 
+	0x00, 0x07, 0x0f, 0x1f, 0x7f, 0xff, 0xfe, 0xf8, 0xf0, 0xc0, 0x84, 0x00, 0x00, 0xf8, 0x86, 0xfe, 
+	0x8b, 0xff, 0x82, 0x00, 0x02, 0x01, 0x07, 0x0f, 0x81, 0xff, 0x01, 0xfc, 0xf0, 0x81, 0x00, 0x01, 
+	0x01, 0x1f, 0x81, 0xff, 0x01, 0xfe, 0xe0, 0x82, 0x00, 0x00, 0x1f, 0x86, 0x7f, 0x8b, 0xff, 0x82, 
+	0x00, 0x02, 0x80, 0xe0, 0xf0, 0x81, 0xff, 0x01, 0x3f, 0x0f, 0x81, 0x00, 0x01, 0x80, 0xf8, 0x81, 
+	0xff, 0x01, 0x7f, 0x07, 0x8c, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0x83, 0xff, 
+	0x82, 0x00, 0x0f, 0x03, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0xe0, 0xf0, 0xf8, 0xfe, 0xff, 0x7f, 
+	0x1f, 0x0f, 0x03, 0x97, 0x00, 0x80, 0x01, 0x8a, 0x00, 0x03, 0x01, 0x03, 0x01, 0x01, 0x87, 0x00
+};
+// 'Discord', 48x48px, 131 bytes compressed from 288
+const unsigned char largeIconDiscord [] PROGMEM = {
+	0x88, 0x00, 0x82, 0x80, 0x82, 0xc0, 0x8a, 0x00, 0x82, 0xc0, 0x82, 0x80, 0x8c, 0x00, 0x03, 0xc0, 
+	0xf0, 0xfc, 0xfe, 0x9e, 0xff, 0x03, 0xfe, 0xfc, 0xf0, 0xe0, 0x83, 0x00, 0x01, 0xe0, 0xfc, 0x87, 
+	0xff, 0x01, 0x7f, 0x3f, 0x82, 0x1f, 0x01, 0x3f, 0x7f, 0x86, 0xff, 0x01, 0x7f, 0x3f, 0x82, 0x1f, 
+	0x01, 0x3f, 0x7f, 0x87, 0xff, 0x03, 0xfc, 0xe0, 0x00, 0xfc, 0x89, 0xff, 0x07, 0xf0, 0xc0, 0xc0, 
+	0x80, 0x80, 0xc0, 0xc0, 0xe0, 0x86, 0xff, 0x07, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0xe0, 
+	0x89, 0xff, 0x05, 0xfc, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x84, 0xff, 0x81, 0xef, 0x00, 0x4f, 0x81, 
+	0x1f, 0x8a, 0x3f, 0x81, 0x1f, 0x00, 0x5f, 0x81, 0xef, 0x84, 0xff, 0x04, 0x7f, 0x3f, 0x3f, 0x1f, 
+	0x0f, 0x86, 0x00, 0x80, 0x01, 0x81, 0x03, 0x00, 0x01, 0x92, 0x00, 0x00, 0x01, 0x81, 0x03, 0x80, 
+	0x01, 0x86, 0x00
+};
+// 'Spotify', 48x48px, 166 bytes compressed from 288
+const unsigned char largeIconSpotify [] PROGMEM = {
+	0x85, 0x00, 0x05, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0x81, 0xfc, 0x81, 0xfe, 0x87, 0xff, 0x82, 
+	0xfe, 0x81, 0xfc, 0x05, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0x80, 0x87, 0x00, 0x03, 0xe0, 0xf0, 0xfc, 
+	0xfe, 0x81, 0xff, 0x00, 0x7f, 0x84, 0x3f, 0x87, 0x1f, 0x84, 0x3f, 0x81, 0x7f, 0x86, 0xff, 0x06, 
+	0xfe, 0xfc, 0xf0, 0xe0, 0x00, 0x00, 0xf8, 0x85, 0xff, 0x00, 0xfe, 0x82, 0xfc, 0x00, 0x7c, 0x8b, 
+	0x7e, 0x00, 0x7c, 0x81, 0xfc, 0x81, 0xf8, 0x81, 0xf0, 0x80, 0xe1, 0x80, 0xe3, 0x84, 0xff, 0x01, 
+	0xf8, 0x0f, 0x87, 0xff, 0x01, 0xf8, 0xf0, 0x83, 0xf8, 0x85, 0xfc, 0x83, 0xf8, 0x80, 0xf0, 0x02, 
+	0xf1, 0xe1, 0xe1, 0x81, 0xc3, 0x00, 0xe7, 0x87, 0xff, 0x06, 0x1f, 0x00, 0x00, 0x07, 0x0f, 0x3f, 
+	0x7f, 0x83, 0xff, 0x80, 0xf1, 0x80, 0xf0, 0x89, 0xf8, 0x80, 0xf0, 0x06, 0xf1, 0xe1, 0xe1, 0xe3, 
+	0xc3, 0xc7, 0xcf, 0x85, 0xff, 0x03, 0x7f, 0x3f, 0x0f, 0x07, 0x87, 0x00, 0x05, 0x01, 0x03, 0x07, 
+	0x0f, 0x0f, 0x1f, 0x81, 0x3f, 0x81, 0x7f, 0x88, 0xff, 0x81, 0x7f, 0x81, 0x3f, 0x05, 0x1f, 0x0f, 
+	0x0f, 0x07, 0x03, 0x01, 0x85, 0x00
+};
+// 'Chrome', 48x48px, 218 bytes compressed from 288
+const unsigned char largeIconChrome [] PROGMEM = {
+	0x87, 0x00, 0x80, 0x80, 0x08, 0xc0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf8, 0x78, 0x78, 0x7c, 0x86, 0x3c, 
+	0x0a, 0x7c, 0x78, 0x78, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x8b, 0x00, 0x0a, 0xc0, 
+	0xf0, 0xf8, 0xfe, 0xff, 0xff, 0xef, 0xc7, 0x03, 0x01, 0x01, 0x82, 0x00, 0x80, 0x80, 0x8a, 0xc0, 
+	0x80, 0xc1, 0x08, 0xc3, 0xc7, 0xcf, 0xdf, 0xff, 0xfe, 0xf8, 0xf0, 0xc0, 0x84, 0x00, 0x00, 0xf8, 
+	0x81, 0xff, 0x0f, 0x0f, 0x01, 0x01, 0x07, 0x1f, 0x3f, 0xff, 0xfc, 0xf8, 0xf8, 0xfe, 0xff, 0x3f, 
+	0x0f, 0x07, 0x07, 0x82, 0x03, 0x80, 0x07, 0x05, 0x0f, 0x3f, 0xff, 0xff, 0xfb, 0xe3, 0x85, 0x03, 
+	0x00, 0x0f, 0x81, 0xff, 0x00, 0xf8, 0x82, 0x00, 0x00, 0x1f, 0x81, 0xff, 0x01, 0xf0, 0x80, 0x83, 
+	0x00, 0x08, 0x03, 0x0f, 0x1f, 0x7f, 0xff, 0xfc, 0xf0, 0xe0, 0xe0, 0x82, 0xc0, 0x80, 0xe0, 0x05, 
+	0xf0, 0xfc, 0xff, 0x7f, 0x1f, 0x07, 0x84, 0x00, 0x01, 0x80, 0xf0, 0x81, 0xff, 0x00, 0x1f, 0x84, 
+	0x00, 0x0a, 0x03, 0x0f, 0x1f, 0x7f, 0xfe, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0x82, 0x00, 0x80, 
+	0x01, 0x16, 0x03, 0x83, 0xe3, 0xfb, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x01, 0x00, 0x00, 0x80, 0x80, 
+	0xc0, 0xe0, 0xf0, 0xf8, 0xfe, 0x7f, 0x1f, 0x0f, 0x03, 0x8b, 0x00, 0x80, 0x01, 0x09, 0x03, 0x07, 
+	0x07, 0x0f, 0x0f, 0x1f, 0x1e, 0x1e, 0x3e, 0x3c, 0x83, 0x3f, 0x80, 0x3c, 0x0a, 0x3e, 0x1e, 0x1e, 
+	0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x01, 0x01, 0x87, 0x00
+};
+// 'Games', 48x48px, 143 bytes compressed from 288
+const unsigned char largeIconGames [] PROGMEM = {
+	0xb3, 0x00, 0x0c, 0xc0, 0x60, 0x38, 0x1c, 0x9e, 0xde, 0x9e, 0x1e, 0x1c, 0x10, 0x10, 0xf0, 0xf0, 
+	0x8a, 0x10, 0x80, 0xf0, 0x80, 0x10, 0x08, 0x1c, 0x1e, 0x9e, 0xde, 0x9e, 0x1c, 0x38, 0x70, 0xc0, 
+	0x85, 0x00, 0x11, 0x80, 0xf0, 0x1f, 0x0f, 0x1c, 0x1c, 0x4c, 0xe3, 0xf3, 0x69, 0x1c, 0x1c, 0x8c, 
+	0xc0, 0xcf, 0xdf, 0xd0, 0x90, 0x86, 0x10, 0x11, 0x90, 0xd0, 0xdf, 0xcf, 0xc0, 0x8c, 0x1c, 0x0c, 
+	0x41, 0xe1, 0xe1, 0x00, 0x0c, 0x0c, 0x03, 0x3f, 0xf0, 0x80, 0x81, 0x00, 0x02, 0xc0, 0xff, 0x03, 
+	0x86, 0x00, 0x0a, 0xc0, 0x70, 0x37, 0x3c, 0x78, 0x78, 0x3c, 0x37, 0x10, 0x16, 0x10, 0x82, 0x16, 
+	0x08, 0x10, 0x37, 0x3c, 0x78, 0x78, 0x3c, 0x3f, 0x70, 0xc0, 0x86, 0x00, 0x10, 0x03, 0xff, 0xc0, 
+	0x00, 0x00, 0x03, 0x1f, 0x38, 0x60, 0x60, 0x40, 0x60, 0x60, 0x30, 0x1c, 0x0f, 0x03, 0x94, 0x00, 
+	0x0b, 0x03, 0x0f, 0x1c, 0x30, 0x60, 0x60, 0x40, 0x60, 0x60, 0x30, 0x1f, 0x03, 0xaf, 0x00
+};
+
+const unsigned char* largeIcons[5] = {
+	largeIconMaster,
+	largeIconDiscord,
+	largeIconSpotify,
+	largeIconChrome,
+	largeIconGames
+};
+
+#if BITMAP_TIMING_REPORT // Only used to compare the draw time of both formats
+// 'Master', 48x48px, 288 bytes uncompressed
+const unsigned char largeIconMasterUncompressed [] PROGMEM = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 	0x00, 0x00, 0x00, 0x80, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -164,138 +291,45 @@ const unsigned char largeIconMaster [] PROGMEM = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 	0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'Games', 48x48px
-const unsigned char largeIconGames [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x38, 0x1c, 0x9e, 0xde, 0x9e, 0x1e, 0x1c, 0x10, 0x10, 
-	0xf0, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0xf0, 
-	0x10, 0x10, 0x1c, 0x1e, 0x9e, 0xde, 0x9e, 0x1c, 0x38, 0x70, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x80, 0xf0, 0x1f, 0x0f, 0x1c, 0x1c, 0x4c, 0xe3, 0xf3, 0x69, 0x1c, 0x1c, 0x8c, 0xc0, 
-	0xcf, 0xdf, 0xd0, 0x90, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0xd0, 0xdf, 0xcf, 
-	0xc0, 0x8c, 0x1c, 0x0c, 0x41, 0xe1, 0xe1, 0x00, 0x0c, 0x0c, 0x03, 0x3f, 0xf0, 0x80, 0x00, 0x00, 
-	0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x37, 0x3c, 
-	0x78, 0x78, 0x3c, 0x37, 0x10, 0x16, 0x10, 0x16, 0x16, 0x16, 0x16, 0x10, 0x37, 0x3c, 0x78, 0x78, 
-	0x3c, 0x3f, 0x70, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 
-	0x00, 0x03, 0x1f, 0x38, 0x60, 0x60, 0x40, 0x60, 0x60, 0x30, 0x1c, 0x0f, 0x03, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x03, 0x0f, 0x1c, 0x30, 0x60, 0x60, 0x40, 0x60, 0x60, 0x30, 0x1f, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Chrome', 48x48px
-const unsigned char largeIconChrome [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf0, 
-	0xf8, 0x78, 0x78, 0x7c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x7c, 0x78, 0x78, 0xf8, 
-	0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xf8, 0xfe, 0xff, 0xff, 0xef, 0xc7, 0x03, 0x01, 0x01, 0x00, 
-	0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-	0xc0, 0xc1, 0xc1, 0xc3, 0xc7, 0xcf, 0xdf, 0xff, 0xfe, 0xf8, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x0f, 0x01, 0x01, 0x07, 0x1f, 0x3f, 0xff, 0xfc, 0xf8, 0xf8, 
-	0xfe, 0xff, 0x3f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x3f, 0xff, 0xff, 
-	0xfb, 0xe3, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 
-	0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 
-	0x7f, 0xff, 0xfc, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0xfc, 0xff, 0x7f, 
-	0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x7f, 0xfe, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x83, 0xe3, 0xfb, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x01, 0x00, 
-	0x00, 0x80, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfe, 0x7f, 0x1f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x0f, 
-	0x1f, 0x1e, 0x1e, 0x3e, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3e, 0x1e, 0x1e, 0x1f, 
-	0x0f, 0x0f, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Discord', 48x48px
-const unsigned char largeIconDiscord [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 
-	0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 
-	0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x1f, 
-	0x1f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x1f, 
-	0x1f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x00, 
-	0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0xc0, 0x80, 
-	0x80, 0xc0, 0xc0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc0, 0xc0, 0x80, 
-	0x80, 0xc0, 0xc0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-	0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x4f, 0x1f, 
-	0x1f, 0x1f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 
-	0x1f, 0x5f, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x1f, 0x0f, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Spotify', 48x48px
-const unsigned char largeIconSpotify [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfc, 
-	0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 
-	0xfc, 0xfc, 0xfc, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xe0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 
-	0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0x00, 0x00, 
-	0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0x7c, 0x7e, 0x7e, 
-	0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7c, 0xfc, 0xfc, 0xfc, 0xf8, 
-	0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xe1, 0xe1, 0xe3, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 
-	0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf1, 
-	0xe1, 0xe1, 0xc3, 0xc3, 0xc3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 
-	0x00, 0x00, 0x07, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf0, 0xf0, 0xf8, 
-	0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf1, 0xe1, 0xe1, 0xe3, 
-	0xc3, 0xc7, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x07, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x3f, 
-	0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 
-	0x3f, 0x3f, 0x3f, 0x1f, 0x0f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
+#endif
 
-const unsigned char* largeIcons[5] = {
-	largeIconMaster,
-	largeIconDiscord,
-	largeIconSpotify,
-	largeIconChrome,
-	largeIconGames
-};
-
-// 'Master', 24x24px
+#define SMALL_ICONS_COMPRESSED true // 309 bytes compressed from 360
+// 'Master', 24x24px, 58 bytes compressed from 72
 const unsigned char smallIconMaster [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x80, 0x80, 
-	0x00, 0x10, 0x38, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x81, 0xe7, 0xff, 0x7c, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x01, 0x01, 
-	0x00, 0x08, 0x1c, 0x0f, 0x07, 0x03, 0x00, 0x00
-};
-// 'Games', 24x24px
-const unsigned char smallIconGames [] PROGMEM = {
-	0x00, 0x00, 0x80, 0x40, 0x60, 0xa0, 0x20, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 
-	0x40, 0x60, 0xa0, 0x60, 0x40, 0x80, 0x00, 0x00, 0x00, 0x78, 0x03, 0x02, 0x0f, 0x0d, 0xc2, 0x7a, 
-	0x6f, 0x7c, 0x64, 0x64, 0x64, 0x64, 0x7c, 0x6f, 0x7a, 0xc2, 0x08, 0x00, 0x02, 0x03, 0x78, 0x00, 
-	0x00, 0x06, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x06, 0x00
+	0x84, 0x00, 0x02, 0x80, 0xc0, 0xe0, 0x81, 0xf0, 0x80, 0x00, 0x80, 0x80, 0x05, 0x00, 0x10, 0x38, 
+	0xf0, 0xe0, 0xc0, 0x81, 0x00, 0x00, 0x7e, 0x88, 0xff, 0x80, 0x00, 0x08, 0x81, 0xe7, 0xff, 0x7c, 
+	0x00, 0x00, 0xff, 0xff, 0x7e, 0x85, 0x00, 0x02, 0x01, 0x03, 0x07, 0x81, 0x0f, 0x80, 0x00, 0x80, 
+	0x01, 0x07, 0x00, 0x08, 0x1c, 0x0f, 0x07, 0x03, 0x00, 0x00
 };
-// 'Chrome', 24x24px
-const unsigned char smallIconChrome [] PROGMEM = {
-	0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xb8, 0x1c, 0x0c, 0x0c, 0x06, 0x86, 0x86, 0x86, 0x86, 0x86, 0x8c, 
-	0x8c, 0x9c, 0xb8, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x81, 0x01, 0x07, 0x0f, 0x3c, 
-	0xff, 0xc3, 0x81, 0x81, 0x81, 0x81, 0xc3, 0xff, 0x3d, 0x01, 0x01, 0x01, 0x81, 0xff, 0x7e, 0x00, 
-	0x00, 0x00, 0x03, 0x07, 0x0e, 0x1c, 0x38, 0x30, 0x30, 0x60, 0x71, 0x79, 0x7f, 0x67, 0x63, 0x30, 
-	0x30, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x00, 0x00
-};
-// 'Discord', 24x24px
+// 'Discord', 24x24px, 54 bytes compressed from 72
 const unsigned char smallIconDiscord [] PROGMEM = {
-	0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 
-	0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x87, 
-	0x87, 0x87, 0xff, 0xff, 0xff, 0xff, 0x87, 0x87, 0x87, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-	0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x1b, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-	0x03, 0x1b, 0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x03
+	0x80, 0x00, 0x03, 0xc0, 0xe0, 0xf0, 0xf0, 0x81, 0xf8, 0x84, 0xf0, 0x81, 0xf8, 0x80, 0xf0, 0x04, 
+	0xe0, 0xc0, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0xc7, 0x81, 0x87, 0x82, 0xff, 0x82, 0x87, 0x83, 
+	0xff, 0x08, 0xf0, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x1b, 0x03, 0x86, 0x07, 0x07, 0x03, 0x1b, 
+	0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x03
 };
-// 'Spotify', 24x24px
+// 'Spotify', 24x24px, 67 bytes compressed from 72
 const unsigned char smallIconSpotify [] PROGMEM = {
-	0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0x7c, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 
-	0xfe, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0xce, 0xce, 0xee, 
-	0xe6, 0xe7, 0xe7, 0xe6, 0xe6, 0xce, 0xce, 0xce, 0xdc, 0x9c, 0x9c, 0xf9, 0xff, 0xff, 0xff, 0x7e, 
-	0x00, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7c, 0x7c, 0x7c, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x79, 
-	0x79, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x00
+	0x05, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0x7c, 0x81, 0x7e, 0x84, 0x7f, 0x09, 0x7e, 0xfe, 0xfe, 0xfc, 
+	0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x7e, 0x81, 0xff, 0x08, 0xfe, 0xce, 0xce, 0xee, 0xe6, 0xe7, 0xe7, 
+	0xe6, 0xe6, 0x81, 0xce, 0x03, 0xdc, 0x9c, 0x9c, 0xf9, 0x81, 0xff, 0x06, 0x7e, 0x00, 0x03, 0x07, 
+	0x0f, 0x1f, 0x3f, 0x81, 0x7c, 0x81, 0xfe, 0x81, 0xfc, 0x80, 0x79, 0x06, 0x7f, 0x3f, 0x1f, 0x0f, 
+	0x07, 0x03, 0x00
+};
+// 'Chrome', 24x24px, 70 bytes compressed from 72
+const unsigned char smallIconChrome [] PROGMEM = {
+	0x80, 0x00, 0x07, 0xc0, 0xe0, 0xf0, 0xb8, 0x1c, 0x0c, 0x0c, 0x06, 0x83, 0x86, 0x80, 0x8c, 0x04, 
+	0x9c, 0xb8, 0xf0, 0xe0, 0xc0, 0x81, 0x00, 0x08, 0x7e, 0xff, 0x81, 0x01, 0x07, 0x0f, 0x3c, 0xff, 
+	0xc3, 0x82, 0x81, 0x02, 0xc3, 0xff, 0x3d, 0x81, 0x01, 0x02, 0x81, 0xff, 0x7e, 0x81, 0x00, 0x15, 
+	0x03, 0x07, 0x0e, 0x1c, 0x38, 0x30, 0x30, 0x60, 0x71, 0x79, 0x7f, 0x67, 0x63, 0x30, 0x30, 0x38, 
+	0x1c, 0x0e, 0x07, 0x03, 0x00, 0x00
+};
+// 'Games', 24x24px, 60 bytes compressed from 72
+const unsigned char smallIconGames [] PROGMEM = {
+	0x80, 0x00, 0x06, 0x80, 0x40, 0x60, 0xa0, 0x20, 0x40, 0xc0, 0x84, 0x40, 0x06, 0xc0, 0x40, 0x60, 
+	0xa0, 0x60, 0x40, 0x80, 0x81, 0x00, 0x08, 0x78, 0x03, 0x02, 0x0f, 0x0d, 0xc2, 0x7a, 0x6f, 0x7c, 
+	0x82, 0x64, 0x0f, 0x7c, 0x6f, 0x7a, 0xc2, 0x08, 0x00, 0x02, 0x03, 0x78, 0x00, 0x00, 0x06, 0x00, 
+	0x00, 0x04, 0x03, 0x8a, 0x00, 0x05, 0x03, 0x04, 0x00, 0x00, 0x06, 0x00
 };
 
 const unsigned char* smallIcons[5] = {
@@ -306,4 +340,71 @@ const unsigned char* smallIcons[5] = {
 	smallIconGames
 };
 
+// Total bytes used to store the images in PROGMEM = 3031 (3720 uncompressed)
+
+// Volume readout digits, the 6x8 font scaled 2x and pre-rendered so no scaling is done at runtime
+// '0', 12x16px
+const unsigned char volumeDigit0 [] PROGMEM = {
+	0x00, 0x00, 0xfc, 0xfc, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0xfc, 0xfc, 0x00, 0x00, 0x0f, 0x0f, 
+	0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x0f, 0x0f
+};
+// '1', 12x16px
+const unsigned char volumeDigit1 [] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00
+};
+// '2', 12x16px
+const unsigned char volumeDigit2 [] PROGMEM = {
+	0x00, 0x00, 0x0c, 0x0c, 0x03, 0x03, 0x03, 0x03, 0xc3, 0xc3, 0x3c, 0x3c, 0x00, 0x00, 0x30, 0x30, 
+	0x3c, 0x3c, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30
+};
+// '3', 12x16px
+const unsigned char volumeDigit3 [] PROGMEM = {
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x33, 0x33, 0xcf, 0xcf, 0x03, 0x03, 0x00, 0x00, 0x0c, 0x0c, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0f, 0x0f
+};
+// '4', 12x16px
+const unsigned char volumeDigit4 [] PROGMEM = {
+	0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0x0c, 0x0c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x03, 0x03
+};
+// '5', 12x16px
+const unsigned char volumeDigit5 [] PROGMEM = {
+	0x00, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xc3, 0xc3, 0x00, 0x00, 0x0c, 0x0c, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0f, 0x0f
+};
+// '6', 12x16px
+const unsigned char volumeDigit6 [] PROGMEM = {
+	0x00, 0x00, 0xf0, 0xf0, 0xcc, 0xcc, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0f, 0x0f
+};
+// '7', 12x16px
+const unsigned char volumeDigit7 [] PROGMEM = {
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+	0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+// '8', 12x16px
+const unsigned char volumeDigit8 [] PROGMEM = {
+	0x00, 0x00, 0x3c, 0x3c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x3c, 0x3c, 0x00, 0x00, 0x0f, 0x0f, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0f, 0x0f
+};
+// '9', 12x16px
+const unsigned char volumeDigit9 [] PROGMEM = {
+	0x00, 0x00, 0x3c, 0x3c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x30, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0x03
+};
+
+const unsigned char* volumeDigits[10] = {
+	volumeDigit0,
+	volumeDigit1,
+	volumeDigit2,
+	volumeDigit3,
+	volumeDigit4,
+	volumeDigit5,
+	volumeDigit6,
+	volumeDigit7,
+	volumeDigit8,
+	volumeDigit9
+};
+
 #endif // bitmaps_h
\ No newline at end of file
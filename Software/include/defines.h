@@ -3,19 +3,29 @@
 
 
 // Soundmixer settings
+// NUM_MIXERS is limited by the icon tables in bitmaps.h and by MIXER_RAM_BUDGET (12 mixers with 25 LEDs and 4 preset banks)
 #define NUM_MIXERS 5
 #define LEDS_PER_MIXER 25
+#define MIXER_RAM_BUDGET 1024 // in bytes, RAM for the LEDs and preset banks of all mixers, the rest is left for the stack and libraries
 
 // button settings
 #define NUM_BUTTONS 2
 #define BUTTON_PIN_1 20 // analog pin A6, cannot be used as digital pin
 #define BUTTON_PIN_2 21 // analog pin A7, cannot be used as digital pin
+#define BUTTON_DEBOUNCE_TIME 30 // in milliseconds, a button has to read the same for this long before a press or release counts
+
+// preset settings
+// each preset bank holds the volume levels and mute states of all mixers
+// button 1 selects the previous bank, button 2 the next one
+#define NUM_PRESET_BANKS 4
+#define PRESET_TIMING_REPORT false // true to report the time from the first edge of a button until its bank is visible on the serial port
 
 // FastLED settings
 #define VOLTS 5
 #define MAX_CURRENT 500 // in milliamps
 #define LED_PIN 2
 #define LED_TYPE WS2812
+#define LED_WS2812B_V5 false // true if LED_TYPE is WS2812B and the parts are V5, which have a reset time of 280us instead of 50us
 #define COLOR_ORDER GRB
 #define GLOBAL_BRIGHTNESS 90
 #define MIN_BRIGHTNESS 60    // from 0 to 255, value of HSV
@@ -24,23 +34,66 @@
 #define FADE_BLACK_STEPS 20  // steps to fade to black
 #define FADE_LIGHT_STEPS 5   // steps to fade in or out
 #define IDLE_TIMEOUT 5000    // in milliseconds
+#define LED_OUTPUT_CHUNKED true  // true to only disable interrupts per LED instead of for the whole frame
+#define LED_TIMING_REPORT false  // true to report the LED frame time and the longest time interrupts were disabled on the serial port
+// the rings can be split across several data pins (lanes) which are sent at the same time, see ledLanePins and ledRingLanes
+// the frame time only depends on the lane with the most rings, this needs LED_OUTPUT_CHUNKED
+// the gap between two LEDs has to stay below the reset time of LED_TYPE (50us, 280us for WS2812B V5 parts)
+// so WS2812 take up to 2 lanes, the longest gap and the frame time of a build are printed by the harness in test/simavr
+#define NUM_LED_LANES 1
+#define LED_SEND_GAP 6       // in microseconds, time to clear the bits of an LED and start its transfer
+#define LED_LANE_GAP 12      // in microseconds, time to scale and transpose the LED of one lane
+#define LED_INTERRUPT_GAP 15 // in microseconds, time pending interrupts may run between two LEDs
+
+// deep idle settings
+// after DEEP_IDLE_TIMEOUT the display and LEDs are turned off and the mcu sleeps between timer ticks
+// encoder pin changes wake the mcu immediately, the buttons are only polled every DEEP_IDLE_BUTTON_POLL_INTERVAL
+#define DEEP_IDLE_TIMEOUT 60000             // in milliseconds, must be larger than IDLE_TIMEOUT
+#define DEEP_IDLE_LEDS_OFF true             // true to turn the LEDs off, false to hold them at the idle brightness
+#define DEEP_IDLE_DISPLAY_OFF true          // true to turn the display off, false to dim it to DEEP_IDLE_DISPLAY_CONTRAST
+#define DEEP_IDLE_DISPLAY_CONTRAST 1        // contrast of the display while dimmed, from 0 to 255
+#define DEEP_IDLE_BUTTON_POLL_INTERVAL 50   // in milliseconds
+#define DEEP_IDLE_MAX_WAKE_LATENCY 10000    // in microseconds, wake-ups slower than this are reported on the serial port
 
 // encoder settings
 #define VOLUME_STEP 3 // step to increase or decrease the volume level per encoder step
+// the encoders are either read directly from the pins in encoderPins
+// or through chained 74HC165 shift registers on the hardware SPI pins (SCK 13, MISO 12), which frees the pins for more mixers
+// with shift registers, pin A, B and switch of mixer i are wired to inputs 3 * i, 3 * i + 1 and 3 * i + 2 of the chain,
+// counted from input A of the register connected to MISO
+// the direct pins only fit 5 mixers, with shift registers NUM_MIXERS is only limited by the icons and MIXER_RAM_BUDGET
+#define ENCODER_INPUT_SHIFT_REGISTER false
+#define SHIFT_REGISTER_LOAD_PIN 10      // parallel load (SH/LD) pin of the shift registers
+#define SHIFT_REGISTER_SPI_CLOCK 4000000 // in Hz
+#define ENCODER_SCAN_REPORT false        // true to report the scan time per mixer and the mixer limits on the serial port
+#define ENCODER_SCAN_BUDGET 100          // in microseconds, time a scan of all mixers may take per loop
+#define ENCODER_INPUT_BYTES ((NUM_MIXERS * 3 + 7) / 8) // one bit per encoder pin
 
 // oled settings
 #define OLED_WIDTH 128
 #define OLED_HEIGHT 64
+#define IDLE_ICONS_PER_PAGE 5      // small icons that fit next to each other below the idle animation
+#define IDLE_ICON_PAGE_TIME 3000   // in milliseconds, with more mixers the idle icons are shown page by page
 #define IDLE_ANIMATION_FRAME_TIME 240 // in milliseconds
 #define NUM_IDLE_ANIMATION_FRAMES 4 // number of frames in the idle animation
+#define BITMAP_TIMING_REPORT false  // true to draw an icon and an animation frame compressed and uncompressed once at boot and report both times on the serial port
+#define VOLUME_DIGIT_WIDTH 12  // width of a pre-rendered volume digit in pixels
+#define VOLUME_DIGIT_HEIGHT 16 // height of a pre-rendered volume digit in pixels
+#define VOLUME_MAX_DIGITS 3    // the volume readout shows 0 to 100
+#define VOLUME_CENTER_X 63     // the volume readout is centered around this x position
+#define VOLUME_PAGE 6          // vertical position of the volume readout in pages (8px each)
 
 // deej settings
 #define DEEJ_UPDATE_INTERVAL 100 // in milliseconds
+#define SERIAL_BAUD_RATE 9600
+
+// boot settings
+#define BOOT_TIMING_REPORT false // true to report when each boot phase finished on the serial port
 
 // Version of the EEPROM data structure
 // This version is used to check if the EEPROM data structure has changed
 // If the version is changed, the EEPROM data will be reset
-#define EEPROM_VERSION 1
+#define EEPROM_VERSION 2
 
 // Mixer indices
 #define ALL_MIXERS 255
@@ -5,13 +5,14 @@
 #include <FastLED.h>
 
 // default colors for the mixers
-const CHSV mixerColors[NUM_MIXERS] = {
+const CHSV mixerColors[] = {
     CHSV(92, 51, 217),   // Master
     CHSV(166, 163, 242), // Discord
     CHSV(100, 214, 184), // Spotify
     CHSV(31, 186, 255),  // Chrome
     CHSV(92, 51, 217)    // Games
 };
+static_assert(sizeof(mixerColors) / sizeof(mixerColors[0]) == NUM_MIXERS, "mixerColors needs a color for each mixer");
 
 // color for muted mixers
 const CHSV muteColor = CHSV(0, 255, 255); // Color for muted mixers (red)
@@ -19,15 +20,67 @@ const CHSV muteColor = CHSV(0, 255, 255); // Color for muted mixers (red)
 // leds array
 CRGB leds[NUM_MIXERS * LEDS_PER_MIXER];
 
+// longest time interrupts were disabled while sending a single LED, in microseconds
+uint8_t maxLEDInterruptLatency = 0;
+// longest time the data line was low between two LEDs of a frame, in microseconds
+uint16_t maxLEDGap = 0;
+// time it took to send the last frame to the LEDs, in microseconds
+unsigned long ledFrameTime = 0;
+
+// number of frames that were sent again because a gap between two LEDs reached the reset time
+uint16_t ledFrameRetries = 0;
+
+// reset time of LED_TYPE in microseconds, the datasheets only guarantee that the LEDs latch a frame after the line
+// was low this long, shorter gaps may latch as well, so the chunked output resends a frame once a gap reaches it
+template <template <uint8_t, EOrder> class Type>
+struct LEDResetTime
+{
+  static const uint16_t value = 50; // WS2812 and most other chips
+};
+template <>
+struct LEDResetTime<WS2812B>
+{
+  static const uint16_t value = LED_WS2812B_V5 ? 280 : 50; // Only the V5 parts specify 280us
+};
+
+// data pins of the LED lanes, all lanes have to be on the same port as they are written at once
+const uint8_t ledLanePins[] = {LED_PIN};
+static_assert(sizeof(ledLanePins) == NUM_LED_LANES, "ledLanePins needs a pin for each of the NUM_LED_LANES lanes");
+// lane each ring is connected to, the rings of a lane are chained in the order of the mixers
+const uint8_t ledRingLanes[] = {0, 0, 0, 0, 0};
+static_assert(sizeof(ledRingLanes) == NUM_MIXERS, "ledRingLanes needs a lane for each of the NUM_MIXERS rings");
+
+// mapping from lanes to rings, created from ledRingLanes by initLEDLanes()
+// lanes on another port than the first lane and rings on an unknown lane are reported on the serial port and left dark
+uint8_t ledLaneRings[NUM_LED_LANES][NUM_MIXERS]; // mixer index of each ring on a lane, in chain order
+uint8_t ledLaneRingCounts[NUM_LED_LANES];        // number of rings on each lane
+uint8_t ledMaxLaneRings;                         // number of rings on the longest lane
+uint8_t ledLaneMasks[NUM_LED_LANES];             // port bit of each lane
+uint8_t ledLanesMask;                            // port bits of all lanes
+volatile uint8_t *ledPort;                       // port of all lanes
+
 // current brightness level for all mixers. Used to fade the LEDs in and out
 // 0% to 100%, from MIN_BRIGHTNESS to maximum brightness defined by value of HSV color
 uint8_t currentBrightnessLevel = 100;
 
+// volume levels and mute states of all mixers for a preset bank
+struct PresetBank
+{
+  uint8_t volumeLevels[NUM_MIXERS];
+  bool isMuted[NUM_MIXERS];
+};
+
+// all preset banks, they are kept in memory so switching only changes the pointers below
+PresetBank presetBanks[NUM_PRESET_BANKS];
+uint8_t activePresetBank = 0;
+
 // Volume levels for each mixer, from 0 to 100%
-uint8_t volumeLevels[NUM_MIXERS];
+// points into the active preset bank
+uint8_t *volumeLevels = presetBanks[0].volumeLevels;
 
 // Mute states for each mixer, true if muted, false if not muted
-bool isMuted[NUM_MIXERS];
+// points into the active preset bank
+bool *isMuted = presetBanks[0].isMuted;
 
 // timer to track the last activity time. Used to determine if the sound mixer is idle
 unsigned long lastActivityTime;
@@ -36,6 +89,17 @@ unsigned long lastActivityTime;
 // This is used to determine if the sound mixer just changed idle state
 bool lastIdleStatus = false;
 
+// true while the sound mixer is in deep idle, the display and LEDs are off and the mcu sleeps between timer ticks
+bool deepIdleActive = false;
+
+// set by the pin change interrupt of the encoders, used to leave deep idle immediately
+volatile bool pinChangeWake = false;
+// time of the last wake-up cause (encoder pin change or button press) in microseconds, used to measure the wake latency
+volatile unsigned long wakeTime;
+
+// last time the buttons were polled, used to poll them less often in deep idle
+unsigned long lastButtonPollTime;
+
 // Flag to indicate if the EEPROM should be updated
 // This is set to true when the volume levels or mute states are changed
 // This is set to false after the EEPROM is updated after the sound mixer has become idle
@@ -48,26 +112,68 @@ uint8_t lastEncAStates[NUM_MIXERS];
 // Encoder switches for each mixer, false if pressed, true if not pressed
 bool lastEncoderSwitchStates[NUM_MIXERS];
 
-// last button states
-bool lastButtonStates[NUM_BUTTONS]; 
+// raw states of all encoder pins, as read by scanEncoders()
+// bit 3 * i is pin A, bit 3 * i + 1 pin B and bit 3 * i + 2 the switch of mixer i
+uint8_t encoderInputs[ENCODER_INPUT_BYTES];
+
+// last button states, debounced
+bool lastButtonStates[NUM_BUTTONS];
+// last raw button readings and the time they last changed, in microseconds
+bool lastButtonReadings[NUM_BUTTONS];
+unsigned long buttonChangeTimes[NUM_BUTTONS];
+// time the raw reading first left the debounced state, in microseconds, kept while the button bounces
+unsigned long buttonEdgeTimes[NUM_BUTTONS];
+bool buttonEdgePending[NUM_BUTTONS];
+// first raw edge of the button that switches the preset bank, and the time until the bank was shown, in microseconds
+// presetSwitchTime is 0 once it was reported, see PRESET_TIMING_REPORT
+unsigned long presetSwitchStartTime = 0;
+unsigned long presetSwitchTime = 0;
 
 // encoder pins for each mixer
 // Each mixer has 3 pins: A, B, and switch
-const uint8_t encoderPins[NUM_MIXERS][3] = {
+const uint8_t encoderPins[][3] = {
     {13, 14, 12}, // Master
     {16, 17, 15}, // Discord
     {4, 5, 3},    // Spotify
     {7, 8, 6},    // Chrome
     {10, 11, 9}   // Games
 };
+#if !ENCODER_INPUT_SHIFT_REGISTER
+static_assert(sizeof(encoderPins) / sizeof(encoderPins[0]) == NUM_MIXERS, "encoderPins needs the pins of each mixer");
+#endif
 
 // current animation frame for the idle animation
 uint8_t currentAnimationFrame = 0;
+// page of mixer icons shown below the idle animation
+uint8_t idleIconPage = 0;
 
 // currently changed mixer index and last changed mixer index
 uint8_t currentMixerIndex = 0; 
 uint8_t lastMixerIndex = 255;
-uint8_t lastVolumeLevel = 100; // if the last volume level was a character larger than the current, clear the area around the volume level
+
+// digits currently shown in the volume readout, most significant first
+// shownVolumeDigitCount is 0 if the readout is not on the display, so it has to be redrawn completely
+uint8_t shownVolumeDigits[VOLUME_MAX_DIGITS];
+uint8_t shownVolumeDigitCount = 0;
+
+// true once the display is initialized
+// the display is initialized in steps across the first loops, so the serial port, LEDs and encoders don't wait for the slow i2c setup
+bool displayReady = false;
+uint8_t displayInitStep = 0;              // next step of initDisplayStep()
+unsigned long maxDisplayInitStepTime = 0; // longest time a step blocked loop(), in microseconds
+
+// phases of the boot, the serial port and the first state frame come first, the display last
+enum BootPhase : uint8_t
+{
+  BOOT_SERIAL,
+  BOOT_FIRST_FRAME,
+  BOOT_LEDS,
+  BOOT_INPUTS,
+  BOOT_DISPLAY,
+  NUM_BOOT_PHASES
+};
+// time since power-on when each boot phase finished, in microseconds
+unsigned long bootPhaseTimes[NUM_BOOT_PHASES];
 
 // order of the animation frames, as indexed in the bitmaps.h file
 const uint8_t animationFrames[NUM_IDLE_ANIMATION_FRAMES] = {0, 1, 2, 1};
@@ -81,14 +187,16 @@ void updateLastActivityTime(bool updateEEPROM = true);
 // check if the sound mixer is idle
 bool isIdle() { return (millis() - lastActivityTime) > IDLE_TIMEOUT; }
 
+// check if the sound mixer has been idle long enough to enter deep idle
+bool isDeepIdle() { return (millis() - lastActivityTime) > DEEP_IDLE_TIMEOUT; }
+
 // calculate the number of LEDs that should be lit up for a given mixer index
 // maps the volume level from 0 to 100% to the number of LEDs per mixer
 uint8_t litUpLEDs(uint8_t mixerIndex) { return map(volumeLevels[mixerIndex], 0, 100, 0, LEDS_PER_MIXER); }
 
-// sets the settings for the FastLED library and fetches the data from the EEPROM
-// initializes the LEDs with the colors and brightness
-// also sets the initial volume levels and mute states for each mixer
-// this function should be called once in the setup() function
+// sets the settings for the FastLED library
+// initializes the LEDs with the colors and brightness of the volume levels and mute states fetched from the EEPROM
+// this function should be called once in the setup() function, after fetchEEPROMData()
 void initMixers();
 
 // sets the brightness of the LEDs for a given mixer index or all mixers
@@ -96,10 +204,40 @@ void initMixers();
 // sets all LEDs that should not be lit up to black
 void setMixerLEDS(uint8_t mixerIndex = ALL_MIXERS);
 
+// sends the leds array to the LED rings
+// uses FastLED.show() or showLEDsChunked(), depending on LED_OUTPUT_CHUNKED
+void showLEDs();
+
+// creates the lane to ring mapping from ledRingLanes and sets the lane pins as output
+// this function is called once in initMixers()
+void initLEDLanes();
+
+// sends the leds array to the LED rings with interrupts only disabled while a single LED is sent
+// FastLED disables them for the whole frame, so encoder changes and serial data could be lost
+// the LED at the same position of every lane is sent at once
+// applies the same brightness, power limit and color correction as FastLED.show()
+// if a gap between two LEDs gets too long, the LEDs are reset and the frame is sent again with interrupts disabled
+void showLEDsChunked();
+
+// sends one frame with interrupts enabled between the LEDs, or disabled for the whole frame if allowInterrupts is false
+// returns false as soon as a gap between two LEDs reaches the reset time of LED_TYPE, the frame then has to be sent again
+bool sendLEDFrame(CRGB adjustment, bool allowInterrupts);
+
+// sets mask in bits[i] for every bit of value that is 1, msb first
+void transposeLEDByte(uint8_t value, uint8_t mask, uint8_t *bits);
+
+// sends one LED on every lane, interrupts have to be disabled
+// bits holds the 24 bits to send, transposed so that each byte holds the port bits of the lanes sending a 1
+// each bit takes 20 cycles (1.25us at 16MHz), a 0 bit is high for 5 cycles, a 1 bit for 12 cycles
+void sendLEDBits(volatile uint8_t *port, uint8_t hi, uint8_t lo, const uint8_t *bits);
+
+// eeprom address of the volume level of a mixer in a preset bank, the mute state is stored in the next byte
+inline int presetEEPROMAddress(uint8_t bank, uint8_t mixerIndex) { return 4 + (bank * NUM_MIXERS + mixerIndex) * 2; }
+
 // initializes the EEPROM with default values if it is empty or the version has changed
 void initEEPROM();
 // fetches the volume levels and mute states from the EEPROM
-// this function is called once in initMixers()
+// this function is called once in the setup() function
 void fetchEEPROMData();
 
 // this function should be called once after the soundmixer has become idle
@@ -114,18 +252,49 @@ void fadeLEDS();
 // checks if the sound mixer is idle and takes appropriate actions
 void checkIdle();
 
-// initializes the encoders by setting the encoder pins as input
+// turns the display and LEDs off and lets the mcu sleep between timer ticks
+// this function is called in the checkIdle() function
+void enterDeepIdle();
+
+// turns the display and LEDs back on after an encoder or button woke the sound mixer
+// reports the wake latency on the serial port if it exceeds DEEP_IDLE_MAX_WAKE_LATENCY
+void exitDeepIdle();
+
+// puts the mcu into idle sleep until the next interrupt
+// timer0 wakes it every millisecond, encoder pin changes and serial data wake it immediately
+void sleepUntilNextInterrupt();
+
+// initializes the encoders by setting the encoder pins as input (or starting SPI for the shift registers)
 // and setting the initial states for the encoders
+// also enables the pin change interrupts used to wake the mcu from deep idle
 void initEncoders();
 
+// reads all encoder pins into encoderInputs, either directly or from the shift registers
+// with shift registers, any changed input wakes the sound mixer from deep idle, as there is no pin change interrupt
+// this function should be called in the loop() function before checkEncoders()
+void scanEncoders();
+
+// returns the state of pin 0 (A), 1 (B) or 2 (switch) of a mixer from the last scan
+inline bool readEncoderInput(uint8_t mixerIndex, uint8_t pin)
+{
+  uint8_t index = mixerIndex * 3 + pin;
+  return encoderInputs[index >> 3] & (1 << (index & 7));
+}
+
 // checks the encoders for changes and updates the volume levels and mute states accordingly
+// uses the pin states read by scanEncoders()
 // this function should be called in the loop() function
 void checkEncoders();
 
 // checks the buttons for changes and acts accordingly
+// button 1 selects the previous preset bank, button 2 the next one
 // this function should be called in the loop() function
 void checkButtons();
 
+// makes a preset bank the active one by pointing volumeLevels and isMuted to it
+// shows the new state with a single LED frame, one display update and one serial message
+void selectPresetBank(uint8_t bank);
+
 // checks if a button is pressed by reading the analog value of the pin
 inline bool isButtonPressed(uint8_t pin) { return analogRead(pin) < 512; };
 
@@ -136,14 +305,47 @@ void initButtons();
 // this function should be called periodically in the loop() function
 void showIdleAnimation();
 
+// draws a page of IDLE_ICONS_PER_PAGE mixer icons below the idle animation
+void drawIdleIcons(uint8_t page);
+
+// draws a bitmap compressed by scripts/generate_bitmaps.py at x (in pixels) and y (in pages)
+// works like ssd1306_drawBitmap(), but the PackBits data is decoded while it is sent to the display
+void drawCompressedBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const unsigned char *bitmap);
+
+// draws a bitmap from bitmaps.h in the format it is stored in, compressed is one of the *_COMPRESSED defines of bitmaps.h
+void drawStoredBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const unsigned char *bitmap, bool compressed);
+
+// draws a bitmap at x (in pixels) on the first page and returns how long that took, in microseconds
+unsigned long timeBitmapDraw(uint8_t x, uint8_t w, uint8_t h, const unsigned char *bitmap, bool compressed);
+
+// draws the first large icon and animation frame compressed and uncompressed once and reports the draw times, see BITMAP_TIMING_REPORT
+void reportBitmapTimes();
+
+// draws the volume level with the pre-rendered digits from bitmaps.h
+// only the digit cells whose value changed are sent to the display
+// if the number of digits changed, the readout is cleared and redrawn completely
+void drawVolumeDigits(uint8_t volume);
+
 // shows the current mixer volume on the oled display
 // this function should be called when the volume level of a mixer changes or the mixer is muted
+// does nothing until the display is initialized
 void showCurrentMixerVolume();
 
+// runs the next step of the OLED display initialization, it is called in every loop() until displayReady is set
+// the first step sets up the display, every further step clears one page, so no loop() waits for the whole screen
+void initDisplayStep();
+
+// sends the boot phase times and the longest display initialization step to the serial port if BOOT_TIMING_REPORT is enabled
+void reportBootTimes();
+
 // sends the current volume levels of all mixers to the serial port so deej can read them
 // only sends the volume levels in the defined interval
 void sendVolumeLevelsToSerial();
 
+// sends the current volume levels of all mixers to the serial port right away
+// output can be changed to capture the line, e.g. in the tests
+void printVolumeLevels(Print &output = Serial);
+
 void setup();
 void loop();
 
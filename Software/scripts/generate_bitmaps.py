@@ -0,0 +1,205 @@
+"""Generates include/bitmaps.h from the source images.
+
+The images are read from the animation/ and icons/ folders next to this project:
+    animation/0.png, 1.png, ...    128x40px idle animation frames
+    icons/large/<Mixer>.png        48x48px icons shown while a mixer is changed
+    icons/small/<Mixer>.png        24x24px icons shown in the idle screen
+Pixels brighter than 50% are turned on.
+
+The animation frames and icons are stored compressed with PackBits, decoded by
+drawCompressedBitmap() in main.cpp while they are sent to the display:
+    control byte n < 128:  n + 1 literal bytes follow
+    control byte n >= 128: the next byte is repeated n - 126 times
+A group of images that PackBits doesn't make smaller (like the dithered animation frames)
+is stored uncompressed instead and drawn with ssd1306_drawBitmap(), the header tells
+main.cpp with ANIMATION_FRAMES_COMPRESSED, LARGE_ICONS_COMPRESSED and SMALL_ICONS_COMPRESSED.
+The volume digits are drawn on every encoder step, so they are stored uncompressed.
+A copy of the first animation frame and large icon in the other format is only built with
+BITMAP_TIMING_REPORT, they are drawn once at boot to compare the draw time of both formats.
+
+Usage: python scripts/generate_bitmaps.py (requires Pillow)
+"""
+
+import os
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER_PATH = os.path.join(PROJECT_DIR, "include", "bitmaps.h")
+
+# order of the mixers, as indexed by largeIcons and smallIcons
+MIXERS = ["Master", "Discord", "Spotify", "Chrome", "Games"]
+
+# digits of the 6x8 display font, one byte per column with the top pixel in bit 0
+FONT_DIGITS = [
+    [0x3E, 0x51, 0x49, 0x45, 0x3E],
+    [0x00, 0x42, 0x7F, 0x40, 0x00],
+    [0x42, 0x61, 0x51, 0x49, 0x46],
+    [0x21, 0x41, 0x45, 0x4B, 0x31],
+    [0x18, 0x14, 0x12, 0x7F, 0x10],
+    [0x27, 0x45, 0x45, 0x45, 0x39],
+    [0x3C, 0x4A, 0x49, 0x49, 0x30],
+    [0x01, 0x71, 0x09, 0x05, 0x03],
+    [0x36, 0x49, 0x49, 0x49, 0x36],
+    [0x06, 0x49, 0x49, 0x29, 0x1E],
+]
+
+
+def load_image(path):
+    """Loads an image and converts it to the vertical 1-bpp layout of the display (one byte per 8px column)."""
+    from PIL import Image
+
+    image = Image.open(path).convert("L")
+    width, height = image.size
+    pixels = image.load()
+    data = bytearray()
+    for page in range(height // 8):
+        for x in range(width):
+            value = 0
+            for bit in range(8):
+                if pixels[x, page * 8 + bit] > 127:
+                    value |= 1 << bit
+            data.append(value)
+    return width, height, bytes(data)
+
+
+def packbits(data):
+    """Compresses data with PackBits, runs of 3 or more bytes (or 2 outside of a literal block) are repeated."""
+    out = bytearray()
+    literals = bytearray()
+
+    def flush():
+        while literals:
+            chunk = literals[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literals[:128]
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 3 or (run == 2 and not literals):
+            flush()
+            out.append(126 + run)
+            out.append(data[i])
+            i += run
+        else:
+            literals.append(data[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def unpackbits(data, size):
+    """Decodes PackBits data, used to check the compressed bitmaps."""
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        control = data[i]
+        i += 1
+        if control < 128:
+            out.extend(data[i:i + control + 1])
+            i += control + 1
+        else:
+            out.extend(bytes([data[i]]) * (control - 126))
+            i += 1
+    return bytes(out)
+
+
+def render_digit(columns):
+    """Scales a 6x8 font digit to 12x16px, so no scaling has to be done at runtime."""
+    scaled = []
+    for column in [0x00] + columns:
+        value = 0
+        for bit in range(8):
+            if column & (1 << bit):
+                value |= 3 << (bit * 2)
+        scaled += [value, value]
+    return bytes([value & 0xFF for value in scaled] + [value >> 8 for value in scaled])
+
+
+def format_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("\t" + ", ".join("0x%02x" % value for value in data[i:i + 16]))
+    return "const unsigned char %s [] PROGMEM = {\n%s\n};\n" % (name, ", \n".join(lines))
+
+
+def format_compressed(label, name, width, height, data):
+    compressed = packbits(data)
+    assert unpackbits(compressed, len(data)) == data
+    comment = "// '%s', %dx%dpx, %d bytes compressed from %d\n" % (label, width, height, len(compressed), len(data))
+    return comment + format_array(name, compressed)
+
+
+def format_uncompressed(label, name, width, height, data):
+    comment = "// '%s', %dx%dpx, %d bytes uncompressed\n" % (label, width, height, len(data))
+    return comment + format_array(name, data)
+
+
+def format_pointers(name, names):
+    return "const unsigned char* %s[%d] = {\n%s\n};\n" % (name, len(names), ",\n".join("\t" + n for n in names))
+
+
+def write_header(frames, largeIcons, smallIcons, path=HEADER_PATH):
+    """Writes bitmaps.h, frames and icons are lists of (label, width, height, data) in the display layout."""
+    parts = ["#ifndef bitmaps_h\n#define bitmaps_h\n\n#include <avr/pgmspace.h>\n#include \"defines.h\"\n\n"]
+    parts.append("// Generated by scripts/generate_bitmaps.py, do not edit by hand.\n")
+    parts.append("// The animation frames and icons are compressed with PackBits and drawn with drawCompressedBitmap(),\n")
+    parts.append("// unless that doesn't make a group smaller, it is then stored uncompressed for ssd1306_drawBitmap().\n\n")
+    total = [0, 0]
+
+    def add_group(items, prefix, pointers, define, timingCopy):
+        # a group is stored in one format, so the pointer table can be drawn without checking each image
+        stored = sum(len(packbits(data)) for _, _, _, data in items)
+        raw = sum(len(data) for _, _, _, data in items)
+        compress = stored < raw
+        parts.append("#define %s %s // %d bytes compressed from %d\n" % (define, "true" if compress else "false", stored, raw))
+        names = []
+        for label, width, height, data in items:
+            name = prefix + label
+            parts.append((format_compressed if compress else format_uncompressed)(label, name, width, height, data))
+            names.append(name)
+        total[0] += stored if compress else raw
+        total[1] += raw
+        parts.append("\n" + format_pointers(pointers, names) + "\n")
+        if timingCopy:
+            label, width, height, data = items[0]
+            name = prefix + label + ("Uncompressed" if compress else "Compressed")
+            parts.append("#if BITMAP_TIMING_REPORT // Only used to compare the draw time of both formats\n")
+            parts.append((format_uncompressed if compress else format_compressed)(label, name, width, height, data))
+            parts.append("#endif\n\n")
+
+    add_group(frames, "animationFrame", "animationFrames_128x40", "ANIMATION_FRAMES_COMPRESSED", True)
+    add_group(largeIcons, "largeIcon", "largeIcons", "LARGE_ICONS_COMPRESSED", True)
+    add_group(smallIcons, "smallIcon", "smallIcons", "SMALL_ICONS_COMPRESSED", False)
+    parts.append("// Total bytes used to store the images in PROGMEM = %d (%d uncompressed)\n\n" % tuple(total))
+
+    parts.append("// Volume readout digits, the 6x8 font scaled 2x and pre-rendered so no scaling is done at runtime\n")
+    for digit, columns in enumerate(FONT_DIGITS):
+        parts.append("// '%d', 12x16px\n" % digit)
+        parts.append(format_array("volumeDigit%d" % digit, render_digit(columns)))
+    parts.append("\n" + format_pointers("volumeDigits", ["volumeDigit%d" % digit for digit in range(10)]))
+    parts.append("\n#endif // bitmaps_h")
+
+    with open(path, "w", newline="\n") as header:
+        header.write("".join(parts))
+    print("%s: %d bytes of images, %d uncompressed" % (path, total[0], total[1]))
+
+
+def main():
+    animationDir = os.path.join(PROJECT_DIR, "animation")
+    iconDir = os.path.join(PROJECT_DIR, "icons")
+    if not os.path.isdir(animationDir) or not os.path.isdir(iconDir):
+        sys.exit("the animation/ and icons/ folders with the source images are missing")
+
+    frameFiles = sorted((f for f in os.listdir(animationDir) if f.endswith(".png")), key=lambda f: int(f[:-4]))
+    frames = [(f[:-4],) + load_image(os.path.join(animationDir, f)) for f in frameFiles]
+    largeIcons = [(m,) + load_image(os.path.join(iconDir, "large", m + ".png")) for m in MIXERS]
+    smallIcons = [(m,) + load_image(os.path.join(iconDir, "small", m + ".png")) for m in MIXERS]
+    write_header(frames, largeIcons, smallIcons)
+
+
+if __name__ == "__main__":
+    main()
@@ -12,9 +12,15 @@
 #include "main.h"
 #include "defines.h"
 #include <EEPROM.h>
+#include <avr/sleep.h>
+#include <SPI.h>
 #include "bitmaps.h"
 #include "ssd1306.h"
 
+static_assert(sizeof(largeIcons) / sizeof(largeIcons[0]) == NUM_MIXERS, "largeIcons needs an icon for each mixer");
+static_assert(sizeof(smallIcons) / sizeof(smallIcons[0]) == NUM_MIXERS, "smallIcons needs an icon for each mixer");
+static_assert(sizeof(leds) + sizeof(presetBanks) <= MIXER_RAM_BUDGET, "The LEDs and preset banks of all mixers exceed MIXER_RAM_BUDGET");
+
 void updateLastActivityTime(bool alsoUpdateEEPROM)
 {
   lastActivityTime = millis();
@@ -28,49 +34,66 @@ void updateLastActivityTime(bool alsoUpdateEEPROM)
 
 void initEEPROM()
 {
-  // the eeprom is used to store the volume levels of the mixers, as well as the mute states
+  // the eeprom is used to store the volume levels of the mixers, as well as the mute states, for each preset bank
   // this function checks if the eeprom is empty and initializes it with default values
   // The layout in the eeprom is as follows:
   // 0: amount of mixers (should be NUM_MIXERS), 0xFF if not set
   // 1: version of the eeprom data structure (should be EEPROM_VERSION), 0xFF if not set
-  // 1, 2: volume level and mute state for mixer 0
-  // 3, 4: volume level and mute state for mixer 1
-  // and so on...
+  // 2: amount of preset banks (should be NUM_PRESET_BANKS), 0xFF if not set
+  // 3: active preset bank
+  // 4, 5: volume level and mute state for mixer 0 of bank 0
+  // 6, 7: volume level and mute state for mixer 1 of bank 0
+  // and so on, followed by the mixers of bank 1...
   // The volume level is stored as a byte, from 0 to 100, and the mute state is stored as a boolean (0 or 1).
   // If the eeprom is empty, it initializes it with default values.
-  if (EEPROM.read(0) != NUM_MIXERS || EEPROM.read(1) != EEPROM_VERSION)
+  if (EEPROM.read(0) != NUM_MIXERS || EEPROM.read(1) != EEPROM_VERSION || EEPROM.read(2) != NUM_PRESET_BANKS)
   {
     // Initialize the eeprom with default values
-    EEPROM.put(0, NUM_MIXERS);
-    EEPROM.put(1, EEPROM_VERSION);
-    for (uint8_t i = 0; i < NUM_MIXERS; i++)
+    EEPROM.put(0, (uint8_t)NUM_MIXERS);
+    EEPROM.put(1, (uint8_t)EEPROM_VERSION);
+    EEPROM.put(2, (uint8_t)NUM_PRESET_BANKS);
+    EEPROM.put(3, (uint8_t)0); // Default to the first preset bank
+    for (uint8_t bank = 0; bank < NUM_PRESET_BANKS; bank++)
     {
-      EEPROM.put(2 + i * 2, 100); // Default volume level to 100%
-      EEPROM.put(3 + i * 2, 0);   // Default mute state to false (0)
+      for (uint8_t i = 0; i < NUM_MIXERS; i++)
+      {
+        EEPROM.put(presetEEPROMAddress(bank, i), (uint8_t)100);   // Default volume level to 100%
+        EEPROM.put(presetEEPROMAddress(bank, i) + 1, (uint8_t)0); // Default mute state to false (0)
+      }
     }
   }
 }
 
 void fetchEEPROMData()
 {
-  // Fetch the volume levels and mute states from the eeprom
-  for (uint8_t i = 0; i < NUM_MIXERS; i++)
+  // Fetch the volume levels and mute states of all preset banks from the eeprom
+  for (uint8_t bank = 0; bank < NUM_PRESET_BANKS; bank++)
   {
-    EEPROM.get(2 + i * 2, volumeLevels[i]); // Read volume level from eeprom
-    EEPROM.get(3 + i * 2, isMuted[i]);      // Read mute state from eeprom
+    for (uint8_t i = 0; i < NUM_MIXERS; i++)
+    {
+      EEPROM.get(presetEEPROMAddress(bank, i), presetBanks[bank].volumeLevels[i]); // Read volume level from eeprom
+      EEPROM.get(presetEEPROMAddress(bank, i) + 1, presetBanks[bank].isMuted[i]);  // Read mute state from eeprom
+    }
   }
+  activePresetBank = EEPROM.read(3) % NUM_PRESET_BANKS;
+  volumeLevels = presetBanks[activePresetBank].volumeLevels;
+  isMuted = presetBanks[activePresetBank].isMuted;
 }
 
 void updateEEPROMData()
 {
   // update volume levels and mute states in the eeprom with eeprom.put()
   // eeprom.put uses eeprom.update internally, so it only writes to the eeprom if the value has changed
-  for (uint8_t i = 0; i < NUM_MIXERS; i++)
+  for (uint8_t bank = 0; bank < NUM_PRESET_BANKS; bank++)
   {
-    EEPROM.put(2 + i * 2, volumeLevels[i]); // Update volume level in eeprom
-    EEPROM.put(3 + i * 2, isMuted[i]);      // Update mute state in eeprom
+    for (uint8_t i = 0; i < NUM_MIXERS; i++)
+    {
+      EEPROM.put(presetEEPROMAddress(bank, i), presetBanks[bank].volumeLevels[i]); // Update volume level in eeprom
+      EEPROM.put(presetEEPROMAddress(bank, i) + 1, presetBanks[bank].isMuted[i]);  // Update mute state in eeprom
+    }
   }
-  updateEEPROM = false; // Reset the update flag
+  EEPROM.put(3, activePresetBank); // Update the active preset bank in eeprom
+  updateEEPROM = false;            // Reset the update flag
 }
 
 void initMixers()
@@ -81,13 +104,11 @@ void initMixers()
   FastLED.setCorrection(TypicalLEDStrip);
   FastLED.setBrightness(GLOBAL_BRIGHTNESS);
   FastLED.clear();
-
-  // Initialize the volume levels and mute states
-  fetchEEPROMData(); // Fetch the data from eeprom
+  initLEDLanes();
 
   // Set the initial LED colors for each mixer
   setMixerLEDS();
-  FastLED.show(); // Show the initial state of the LEDs
+  showLEDs(); // Show the initial state of the LEDs
 }
 
 void setMixerLEDS(uint8_t mixerIndex)
@@ -111,6 +132,194 @@ void setMixerLEDS(uint8_t mixerIndex)
   }
 }
 
+#if NUM_LED_LANES > 1 && !LED_OUTPUT_CHUNKED
+#error "Multiple LED lanes need LED_OUTPUT_CHUNKED"
+#endif
+#if LED_OUTPUT_CHUNKED
+static_assert(LED_SEND_GAP + NUM_LED_LANES * LED_LANE_GAP + LED_INTERRUPT_GAP < LEDResetTime<LED_TYPE>::value,
+              "The gap between two LEDs on this many lanes is longer than the reset time of LED_TYPE");
+#endif
+
+void showLEDs()
+{
+#if LED_OUTPUT_CHUNKED
+  showLEDsChunked();
+#else
+  FastLED.show();
+#endif
+}
+
+void initLEDLanes()
+{
+  uint8_t port = digitalPinToPort(ledLanePins[0]);
+  ledPort = portOutputRegister(port);
+  ledLanesMask = 0;
+  for (uint8_t lane = 0; lane < NUM_LED_LANES; lane++)
+  {
+    ledLaneMasks[lane] = 0;
+    ledLaneRingCounts[lane] = 0;
+    if (port == NOT_A_PIN || digitalPinToPort(ledLanePins[lane]) != port)
+    {
+      Serial.print("LED lane ");
+      Serial.print(lane);
+      Serial.println(" is not a pin on the port of lane 0, its rings stay dark");
+      continue;
+    }
+    pinMode(ledLanePins[lane], OUTPUT);
+    ledLaneMasks[lane] = digitalPinToBitMask(ledLanePins[lane]);
+    ledLanesMask |= ledLaneMasks[lane];
+  }
+
+  ledMaxLaneRings = 0;
+  for (uint8_t i = 0; i < NUM_MIXERS; i++)
+  {
+    uint8_t lane = ledRingLanes[i];
+    if (lane >= NUM_LED_LANES || ledLaneMasks[lane] == 0)
+    {
+      Serial.print("LED ring ");
+      Serial.print(i);
+      Serial.println(" is on an unusable lane, it stays dark");
+      continue;
+    }
+    ledLaneRings[lane][ledLaneRingCounts[lane]++] = i; // Append the ring to its lane
+    if (ledLaneRingCounts[lane] > ledMaxLaneRings)
+      ledMaxLaneRings = ledLaneRingCounts[lane];
+  }
+}
+
+void sendLEDBits(volatile uint8_t *port, uint8_t hi, uint8_t lo, const uint8_t *bits)
+{
+  uint8_t count = 24;
+  uint8_t value;
+  asm volatile(
+      "1:                      \n\t"
+      "st   %a[port], %[hi]    \n\t" // 2  rising edge of all lanes
+      "ld   %[value], %a[bits]+\n\t" // 2  lanes sending a 1 bit
+      "or   %[value], %[lo]    \n\t" // 1
+      "st   %a[port], %[value] \n\t" // 2  falling edge of the lanes sending a 0 bit
+      "rjmp .+0                \n\t" // 2
+      "rjmp .+0                \n\t" // 2
+      "nop                     \n\t" // 1
+      "st   %a[port], %[lo]    \n\t" // 2  falling edge of the lanes sending a 1 bit
+      "dec  %[count]           \n\t" // 1
+      "rjmp .+0                \n\t" // 2
+      "nop                     \n\t" // 1
+      "brne 1b                 \n\t" // 2
+      : [value] "=&r"(value), [count] "+r"(count), [bits] "+e"(bits)
+      : [port] "e"(port), [hi] "r"(hi), [lo] "r"(lo)
+      : "memory"); // Reads bits[] and writes the port behind the compiler's back
+}
+
+void transposeLEDByte(uint8_t value, uint8_t mask, uint8_t *bits)
+{
+  // unrolled, so each bit is a skip and a read-modify-write at a fixed offset, this runs for every lane between two LEDs
+  if (value & 0x80)
+    bits[0] |= mask;
+  if (value & 0x40)
+    bits[1] |= mask;
+  if (value & 0x20)
+    bits[2] |= mask;
+  if (value & 0x10)
+    bits[3] |= mask;
+  if (value & 0x08)
+    bits[4] |= mask;
+  if (value & 0x04)
+    bits[5] |= mask;
+  if (value & 0x02)
+    bits[6] |= mask;
+  if (value & 0x01)
+    bits[7] |= mask;
+}
+
+bool sendLEDFrame(CRGB adjustment, bool allowInterrupts)
+{
+  uint8_t endTicks = 0; // Timer0 ticks every 4us
+  bool firstLED = true;
+  if (!allowInterrupts)
+    noInterrupts();
+  for (uint8_t ringSlot = 0; ringSlot < ledMaxLaneRings; ringSlot++)
+  {
+    for (uint8_t led = 0; led < LEDS_PER_MIXER; led++)
+    {
+      // transpose the LED of every lane before disabling interrupts, so only the transfer itself blocks them
+      uint8_t bits[24] = {0};
+      for (uint8_t lane = 0; lane < NUM_LED_LANES; lane++)
+      {
+        if (ringSlot >= ledLaneRingCounts[lane])
+          continue; // All rings of this lane are sent, it only gets 0 bits
+        CRGB color = leds[ledLaneRings[lane][ringSlot] * LEDS_PER_MIXER + led];
+        color.r = scale8(color.r, adjustment.r);
+        color.g = scale8(color.g, adjustment.g);
+        color.b = scale8(color.b, adjustment.b);
+        // COLOR_ORDER stores the channel index of each byte in octal
+        uint8_t channels[3] = {color.raw[(COLOR_ORDER >> 6) & 0x3], color.raw[(COLOR_ORDER >> 3) & 0x3], color.raw[COLOR_ORDER & 0x3]};
+        uint8_t mask = ledLaneMasks[lane];
+        transposeLEDByte(channels[0], mask, bits);
+        transposeLEDByte(channels[1], mask, bits + 8);
+        transposeLEDByte(channels[2], mask, bits + 16);
+      }
+
+      noInterrupts();
+      uint8_t startTicks = TCNT0;
+      uint16_t gap = (uint8_t)(startTicks - endTicks) * 4; // Low time since the previous LED
+      if (!firstLED && gap > maxLEDGap)
+        maxLEDGap = gap;
+      if (!firstLED && gap + 4 >= LEDResetTime<LED_TYPE>::value) // The timer may be up to 4us behind
+      {
+        interrupts();
+        return false; // The LEDs may have latched the part of the frame that was sent so far
+      }
+      uint8_t lo = *ledPort & ~ledLanesMask; // read the port with interrupts disabled, so no other pin of the port is changed
+      sendLEDBits(ledPort, lo | ledLanesMask, lo, bits);
+      endTicks = TCNT0;
+      if (allowInterrupts)
+        interrupts(); // pending interrupts run here, the gap check above notices if they took too long
+      uint8_t latency = (uint8_t)(endTicks - startTicks) * 4;
+      if (latency > maxLEDInterruptLatency)
+        maxLEDInterruptLatency = latency;
+      firstLED = false;
+    }
+  }
+  interrupts();
+  return true;
+}
+
+void showLEDsChunked()
+{
+  if (ledLanesMask == 0)
+    return; // No usable lane, ledPort may not be a port
+  uint8_t brightness = calculate_max_brightness_for_power_vmA(leds, NUM_MIXERS * LEDS_PER_MIXER, GLOBAL_BRIGHTNESS, VOLTS, MAX_CURRENT);
+  CRGB adjustment = CLEDController::computeAdjustment(brightness, TypicalLEDStrip, UncorrectedTemperature);
+
+  unsigned long frameStartTime = micros();
+  if (!sendLEDFrame(adjustment, true))
+  {
+    // like FastLED's interrupt tolerant output, reset the LEDs and send the whole frame again without interruptions
+    delayMicroseconds(LEDResetTime<LED_TYPE>::value);
+    sendLEDFrame(adjustment, false);
+    ledFrameRetries++;
+  }
+  ledFrameTime = micros() - frameStartTime;
+
+#if LED_TIMING_REPORT
+  EVERY_N_MILLISECONDS(1000)
+  {
+    Serial.print("LED frame: ");
+    Serial.print(ledFrameTime);
+    Serial.print("us on ");
+    Serial.print(NUM_LED_LANES);
+    Serial.print(" lanes, interrupt latency: ");
+    Serial.print(maxLEDInterruptLatency);
+    Serial.print("us, longest gap between LEDs: ");
+    Serial.print(maxLEDGap);
+    Serial.print("us of ");
+    Serial.print(LEDResetTime<LED_TYPE>::value);
+    Serial.print("us, resent frames: ");
+    Serial.println(ledFrameRetries);
+  }
+#endif
+}
+
 void fadeLEDS()
 {
   if (isIdle() && currentBrightnessLevel > 0)
@@ -120,7 +329,7 @@ void fadeLEDS()
       uint8_t stepAmount = (100 / FADE_BLACK_STEPS);
       currentBrightnessLevel = currentBrightnessLevel > stepAmount ? currentBrightnessLevel - stepAmount : 0;
       setMixerLEDS(ALL_MIXERS);
-      FastLED.show();
+      showLEDs();
     }
   }
   else if (!isIdle() && currentBrightnessLevel < 100)
@@ -130,7 +339,7 @@ void fadeLEDS()
       uint8_t stepAmount = (100 / FADE_LIGHT_STEPS);
       currentBrightnessLevel = (100 - currentBrightnessLevel) > stepAmount ? currentBrightnessLevel + stepAmount : 100;
       setMixerLEDS(ALL_MIXERS);
-      FastLED.show();
+      showLEDs();
     }
   }
 }
@@ -147,19 +356,25 @@ void checkIdle()
     currentMixerIndex = 255;   // Reset the current mixer index to an invalid value
     lastMixerIndex = 255;      // Reset the last mixer index to an invalid value
     ssd1306_clearScreen();     // Clear the OLED display
+    shownVolumeDigitCount = 0; // The volume readout is no longer shown
     // show the mixer icons below the animation
-    for (uint8_t i = 0; i < NUM_MIXERS; i++)
-    {
-      uint8_t xPosition = i * (24 + 2); // size of the icon + 3px padding
-      const unsigned char *icon = smallIcons[i];
-      ssd1306_drawBitmap(xPosition, 5, 24, 24, icon); // Draw the mixer icon at the bottom of the display
-    }
+    idleIconPage = 0;
+    drawIdleIcons(idleIconPage);
   }
   else if (lastIdleStatus && !isIdle()) // just changed to active
   {
     // nothing yet here
   }
 
+  if (!deepIdleActive && isDeepIdle())
+    enterDeepIdle(); // The sound mixer has been idle for a long time, turn everything off
+
+  if (deepIdleActive)
+  {
+    lastIdleStatus = true;
+    return; // Nothing to fade or animate while in deep idle
+  }
+
   fadeLEDS(); // Check if the sound mixer is idle and fade the LEDs accordingly
 
   if (isIdle())
@@ -171,26 +386,170 @@ void checkIdle()
   lastIdleStatus = isIdle(); // Update the last idle status
 }
 
+void enterDeepIdle()
+{
+  deepIdleActive = true;
+  pinChangeWake = false; // Only pin changes from now on should wake the sound mixer
+#if DEEP_IDLE_LEDS_OFF
+  FastLED.clear(); // Turn all LEDs off
+  showLEDs();
+#endif
+#if DEEP_IDLE_DISPLAY_OFF
+  ssd1306_displayOff();
+#else
+  ssd1306_setContrast(DEEP_IDLE_DISPLAY_CONTRAST);
+#endif
+}
+
+void exitDeepIdle()
+{
+  deepIdleActive = false;
+  updateLastActivityTime(false); // Stay awake even if the pin change was no full encoder step
+
+  // restore the LEDs first, the display takes longer to come back
+  setMixerLEDS(ALL_MIXERS);
+  showLEDs();
+  noInterrupts();
+  unsigned long wakeLatency = micros() - wakeTime; // wakeTime is written by the pin change interrupt
+  pinChangeWake = false;
+  interrupts();
+
+#if DEEP_IDLE_DISPLAY_OFF
+  ssd1306_displayOn();
+#else
+  ssd1306_setContrast(255);
+#endif
+
+  if (wakeLatency > DEEP_IDLE_MAX_WAKE_LATENCY)
+  {
+    Serial.print("Wake latency exceeded: ");
+    Serial.print(wakeLatency);
+    Serial.println("us");
+  }
+}
+
+void sleepUntilNextInterrupt()
+{
+  set_sleep_mode(SLEEP_MODE_IDLE); // Idle mode keeps timer0 and the uart running
+  noInterrupts();
+  if (!pinChangeWake) // Don't sleep if an encoder changed since the last check
+  {
+    sleep_enable();
+    interrupts(); // The instruction after sei is always executed, so no interrupt is missed before sleeping
+    sleep_cpu();
+    sleep_disable();
+  }
+  interrupts();
+}
+
+#if !ENCODER_INPUT_SHIFT_REGISTER
+// the encoder pins are spread over all three pin change interrupt vectors
+// the interrupts are only used to wake the mcu, the encoders are still read in checkEncoders()
+ISR(PCINT0_vect)
+{
+  if (!pinChangeWake) // Only the first pin change counts for the wake latency
+    wakeTime = micros();
+  pinChangeWake = true;
+}
+ISR(PCINT1_vect, ISR_ALIASOF(PCINT0_vect));
+ISR(PCINT2_vect, ISR_ALIASOF(PCINT0_vect));
+#endif
+
 void initEncoders()
 {
+#if ENCODER_INPUT_SHIFT_REGISTER
+  FastPin<SHIFT_REGISTER_LOAD_PIN>::setOutput();
+  FastPin<SHIFT_REGISTER_LOAD_PIN>::hi();
+  SPI.begin();
+#else
+  for (uint8_t i = 0; i < NUM_MIXERS; i++)
+  {
+    for (uint8_t pin : encoderPins[i])
+    {
+      pinMode(pin, INPUT);
+      // Enable the pin change interrupt for this pin
+      *digitalPinToPCMSK(pin) |= bit(digitalPinToPCMSKbit(pin));
+      *digitalPinToPCICR(pin) |= bit(digitalPinToPCICRbit(pin));
+    }
+  }
+#endif
+
+  scanEncoders(); // Read the initial state of all encoder pins
+  for (uint8_t i = 0; i < NUM_MIXERS; i++)
+  {
+    encAStates[i] = readEncoderInput(i, 0); // Read the initial state of the encoder A pin
+    lastEncAStates[i] = encAStates[i];      // Store the initial state of the encoder A pin
+    lastEncoderSwitchStates[i] = true;      // Initialize the encoder switch states to true
+  }
+}
+
+void scanEncoders()
+{
+#if ENCODER_SCAN_REPORT
+  unsigned long scanStartTime = micros();
+#endif
+
+#if ENCODER_INPUT_SHIFT_REGISTER
+  FastPin<SHIFT_REGISTER_LOAD_PIN>::lo(); // Latch all inputs into the shift registers
+  FastPin<SHIFT_REGISTER_LOAD_PIN>::hi();
+  bool changed = false;
+  SPI.beginTransaction(SPISettings(SHIFT_REGISTER_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+  for (uint8_t i = 0; i < ENCODER_INPUT_BYTES; i++)
+  {
+    // input H is shifted out first, so with MSBFIRST input A ends up in bit 0
+    uint8_t value = SPI.transfer(0);
+    changed |= value != encoderInputs[i];
+    encoderInputs[i] = value;
+  }
+  SPI.endTransaction();
+  if (changed && !pinChangeWake) // Works like the pin change interrupt, which is not available with shift registers
+  {
+    wakeTime = micros();
+    pinChangeWake = true;
+  }
+#else
+  for (uint8_t i = 0; i < ENCODER_INPUT_BYTES; i++)
+  {
+    encoderInputs[i] = 0;
+  }
   for (uint8_t i = 0; i < NUM_MIXERS; i++)
   {
-    pinMode(encoderPins[i][0], INPUT);
-    pinMode(encoderPins[i][1], INPUT);
-    pinMode(encoderPins[i][2], INPUT);
-    encAStates[i] = digitalRead(encoderPins[i][0]); // Read the initial state of the encoder A pin
-    lastEncAStates[i] = encAStates[i];              // Store the initial state of the encoder A pin
-    lastEncoderSwitchStates[i] = true;              // Initialize the encoder switch states to true
+    for (uint8_t pin = 0; pin < 3; pin++)
+    {
+      uint8_t index = i * 3 + pin;
+      if (digitalRead(encoderPins[i][pin]))
+        encoderInputs[index >> 3] |= 1 << (index & 7);
+    }
+  }
+#endif
+
+#if ENCODER_SCAN_REPORT
+  unsigned long scanTime = micros() - scanStartTime;
+  EVERY_N_MILLISECONDS(1000)
+  {
+    Serial.print("Encoder scan: ");
+    unsigned long mixerScanTime = scanTime * 10 / NUM_MIXERS; // Tenths of a microsecond, the scan of a single mixer is short
+    Serial.print(mixerScanTime);
+    Serial.print("/10us per mixer, max mixers: ");
+    Serial.print(ENCODER_SCAN_BUDGET * 10UL / max(mixerScanTime, 1UL));
+    Serial.print(" by scan time, ");
+    Serial.print(MIXER_RAM_BUDGET * NUM_MIXERS / (sizeof(leds) + sizeof(presetBanks)));
+    Serial.print(" by RAM, ");
+    Serial.print(sizeof(largeIcons) / sizeof(largeIcons[0]));
+    Serial.println(" by icons");
   }
+#endif
 }
 
 void initButtons()
 {
   pinMode(BUTTON_PIN_1, INPUT);
   pinMode(BUTTON_PIN_2, INPUT);
-  for (bool &state : lastButtonStates)
+  for (uint8_t i = 0; i < NUM_BUTTONS; i++)
   {
-    state = false; // Initialize button states to false (not pressed)
+    lastButtonStates[i] = lastButtonReadings[i] = false; // Initialize button states to false (not pressed)
+    buttonChangeTimes[i] = 0;
+    buttonEdgePending[i] = false;
   }
 }
 
@@ -199,10 +558,10 @@ void checkEncoders()
   // Check the encoders for changes and update the volume levels and mute states accordingly
   for (uint8_t i = 0; i < NUM_MIXERS; i++)
   {
-    encAStates[i] = digitalRead(encoderPins[i][0]); // Read the current state of the encoder A pin
+    encAStates[i] = readEncoderInput(i, 0); // Read the current state of the encoder A pin
     if (encAStates[i] != lastEncAStates[i])         // If the state has changed
     {
-      if (digitalRead(encoderPins[i][1]) != encAStates[i]) // If the encoder A pin is high and the B pin is low, we are rotating clockwise
+      if (readEncoderInput(i, 1) != encAStates[i]) // If the encoder A pin is high and the B pin is low, we are rotating clockwise
       {
         if (volumeLevels[i] < 100) // Increase volume level if not at maximum
         {
@@ -223,11 +582,11 @@ void checkEncoders()
       currentMixerIndex = i;              // Set the current mixer index to the one being adjusted
       updateLastActivityTime(true);       // Update the last activity time and set updateEEPROM to true
       setMixerLEDS(i);                    // Update the LEDs for this mixer
-      FastLED.show();                     // Show the updated state of the LEDs
+      showLEDs();                         // Show the updated state of the LEDs
       showCurrentMixerVolume();           // Show the current mixer volume on the OLED display
     }
     // Check the encoder switch state
-    bool currentSwitchState = digitalRead(encoderPins[i][2]);
+    bool currentSwitchState = readEncoderInput(i, 2);
     if (currentSwitchState != lastEncoderSwitchStates[i]) // If the switch state has changed
     {
       lastEncoderSwitchStates[i] = currentSwitchState; // Update the switch state
@@ -238,7 +597,7 @@ void checkEncoders()
         isMuted[i] = !isMuted[i];
         updateLastActivityTime(true);
         setMixerLEDS(i);
-        FastLED.show();
+        showLEDs();
         showCurrentMixerVolume();           // Show the current mixer volume on the OLED display
       }
     }
@@ -247,18 +606,98 @@ void checkEncoders()
 
 void checkButtons()
 {
-  bool button1Pressed = isButtonPressed(BUTTON_PIN_1);
-  bool button2Pressed = isButtonPressed(BUTTON_PIN_2);
-  if (button1Pressed) // If button 1 is pressed
+  if (deepIdleActive && millis() - lastButtonPollTime < DEEP_IDLE_BUTTON_POLL_INTERVAL)
+    return; // Reading the buttons takes a while, so they are polled less often in deep idle
+  lastButtonPollTime = millis();
+
+  bool buttonReadings[NUM_BUTTONS] = {isButtonPressed(BUTTON_PIN_1), isButtonPressed(BUTTON_PIN_2)};
+  if (deepIdleActive && (buttonReadings[0] || buttonReadings[1]))
   {
-    Serial.println("Button 1 pressed");
-    updateLastActivityTime(false);
+    wakeTime = micros(); // The buttons can't wake the mcu, so the latency is measured from the poll
+    exitDeepIdle();
+    // the press only wakes the sound mixer, it does not switch the preset bank
+    for (uint8_t i = 0; i < NUM_BUTTONS; i++)
+    {
+      lastButtonStates[i] = lastButtonReadings[i] = buttonReadings[i];
+      buttonChangeTimes[i] = micros();
+      buttonEdgePending[i] = false;
+    }
+    return;
   }
-  if (button2Pressed) // If button 2 is pressed
+
+  // a button only changes its state once its reading was stable for BUTTON_DEBOUNCE_TIME, so a bouncing contact is a single press
+  bool buttonPressed[NUM_BUTTONS] = {false};
+  unsigned long now = micros();
+  for (uint8_t i = 0; i < NUM_BUTTONS; i++)
   {
-    Serial.println("Button 2 pressed");
+    bool settled = now - buttonChangeTimes[i] >= BUTTON_DEBOUNCE_TIME * 1000UL;
+    if (buttonReadings[i] != lastButtonReadings[i])
+    {
+      if (!buttonEdgePending[i]) // The first edge away from the debounced state, later ones are bounces
+      {
+        buttonEdgeTimes[i] = now;
+        buttonEdgePending[i] = true;
+      }
+      lastButtonReadings[i] = buttonReadings[i];
+      buttonChangeTimes[i] = now; // Still bouncing, wait until the reading settles
+    }
+    else if (buttonReadings[i] != lastButtonStates[i] && settled)
+    {
+      lastButtonStates[i] = buttonReadings[i];
+      buttonPressed[i] = buttonReadings[i];
+      buttonEdgePending[i] = false;
+    }
+    else if (settled)
+    {
+      buttonEdgePending[i] = false; // The reading went back to the debounced state, it was a glitch
+    }
+  }
+  if (lastButtonStates[0] || lastButtonStates[1])
     updateLastActivityTime(false);
+
+  if (buttonPressed[0]) // If button 1 was just pressed, select the previous preset bank
+  {
+    presetSwitchStartTime = buttonEdgeTimes[0];
+    selectPresetBank((activePresetBank + NUM_PRESET_BANKS - 1) % NUM_PRESET_BANKS);
+  }
+  if (buttonPressed[1]) // If button 2 was just pressed, select the next preset bank
+  {
+    presetSwitchStartTime = buttonEdgeTimes[1];
+    selectPresetBank((activePresetBank + 1) % NUM_PRESET_BANKS);
   }
+
+#if PRESET_TIMING_REPORT
+  EVERY_N_MILLISECONDS(1000)
+  {
+    if (presetSwitchTime != 0) // Only report new switches
+    {
+      Serial.print("Preset bank ");
+      Serial.print(activePresetBank);
+      Serial.print(": ");
+      Serial.print(presetSwitchTime);
+      Serial.println("us from the first button edge");
+      presetSwitchTime = 0;
+    }
+  }
+#endif
+}
+
+void selectPresetBank(uint8_t bank)
+{
+  activePresetBank = bank;
+  volumeLevels = presetBanks[bank].volumeLevels;
+  isMuted = presetBanks[bank].isMuted;
+  updateLastActivityTime(true); // The active preset bank is stored in the eeprom once the sound mixer is idle
+
+  // show the whole bank at once instead of updating each mixer
+  setMixerLEDS(ALL_MIXERS);
+  showLEDs();
+  lastMixerIndex = currentMixerIndex; // Keep the shown mixer, only its volume is redrawn
+  if (currentMixerIndex == 255)       // Coming from the idle screen, show the first mixer
+    currentMixerIndex = 0;
+  showCurrentMixerVolume();
+  printVolumeLevels(); // Tell deej about the new volume levels right away
+  presetSwitchTime = max(micros() - presetSwitchStartTime, 1UL); // Reported by checkButtons()
 }
 
 void showIdleAnimation()
@@ -266,13 +705,113 @@ void showIdleAnimation()
   EVERY_N_MILLISECONDS(IDLE_ANIMATION_FRAME_TIME)
   {
     const unsigned char *frame = animationFrames_128x40[animationFrames[currentAnimationFrame]];
-    ssd1306_drawBitmap(0, 0, 128, 40, frame);                                        // Draw the current animation frame on the OLED display
+    drawStoredBitmap(0, 0, 128, 40, frame, ANIMATION_FRAMES_COMPRESSED);             // Draw the current animation frame on the OLED display
     currentAnimationFrame = (currentAnimationFrame + 1) % NUM_IDLE_ANIMATION_FRAMES; // Cycle through the animation frames
   }
+#if NUM_MIXERS > IDLE_ICONS_PER_PAGE
+  EVERY_N_MILLISECONDS(IDLE_ICON_PAGE_TIME)
+  {
+    idleIconPage = (idleIconPage + 1) % ((NUM_MIXERS + IDLE_ICONS_PER_PAGE - 1) / IDLE_ICONS_PER_PAGE);
+    drawIdleIcons(idleIconPage);
+  }
+#endif
+}
+
+void drawIdleIcons(uint8_t page)
+{
+  for (uint8_t slot = 0; slot < IDLE_ICONS_PER_PAGE; slot++)
+  {
+    uint8_t mixerIndex = page * IDLE_ICONS_PER_PAGE + slot;
+    uint8_t xPosition = slot * (24 + 2); // size of the icon + 2px padding
+    if (mixerIndex < NUM_MIXERS)
+      drawStoredBitmap(xPosition, 5, 24, 24, smallIcons[mixerIndex], SMALL_ICONS_COMPRESSED); // Draw the mixer icon at the bottom of the display
+    else
+      ssd1306_clearBlock(xPosition, 5, 24, 24); // The last page is not full, remove the icon of the previous page
+  }
+}
+
+void drawCompressedBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const unsigned char *bitmap)
+{
+  // the bitmap is decoded straight into the display transfer, so no buffer is needed
+  ssd1306_lcd.set_block(x, y, w);
+  uint16_t remaining = w * (h >> 3);
+  uint8_t column = 0;
+  while (remaining > 0)
+  {
+    uint8_t control = pgm_read_byte(bitmap++);
+    bool repeat = control > 127; // Either a run of a single byte or a block of literal bytes follows
+    uint8_t count = repeat ? control - 126 : control + 1;
+    uint8_t value = repeat ? pgm_read_byte(bitmap++) : 0;
+    remaining -= count;
+    for (; count > 0; count--)
+    {
+      if (!repeat)
+        value = pgm_read_byte(bitmap++);
+      ssd1306_lcd.send_pixels1(value);
+      if (++column == w) // Continue on the next page at the end of each row
+      {
+        column = 0;
+        ssd1306_lcd.next_page();
+      }
+    }
+  }
+  ssd1306_intf.stop();
+}
+
+void drawStoredBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const unsigned char *bitmap, bool compressed)
+{
+  if (compressed)
+    drawCompressedBitmap(x, y, w, h, bitmap);
+  else
+    ssd1306_drawBitmap(x, y, w, h, bitmap);
+}
+
+unsigned long timeBitmapDraw(uint8_t x, uint8_t w, uint8_t h, const unsigned char *bitmap, bool compressed)
+{
+  unsigned long drawStartTime = micros();
+  drawStoredBitmap(x, 0, w, h, bitmap, compressed);
+  return micros() - drawStartTime;
+}
+
+void reportBitmapTimes()
+{
+#if BITMAP_TIMING_REPORT
+  // bitmaps.h has a copy of the first icon and animation frame in the format they are not stored in
+#if LARGE_ICONS_COMPRESSED
+  const unsigned char *icons[2] = {largeIcons[0], largeIconMasterUncompressed};
+#else
+  const unsigned char *icons[2] = {largeIconMasterCompressed, largeIcons[0]};
+#endif
+#if ANIMATION_FRAMES_COMPRESSED
+  const unsigned char *frames[2] = {animationFrames_128x40[0], animationFrame0Uncompressed};
+#else
+  const unsigned char *frames[2] = {animationFrame0Compressed, animationFrames_128x40[0]};
+#endif
+  // draw each bitmap in both formats at the same place, so only the decoding differs
+  unsigned long iconTimes[2] = {timeBitmapDraw(39, 48, 48, icons[0], true), timeBitmapDraw(39, 48, 48, icons[1], false)};
+  unsigned long frameTimes[2] = {timeBitmapDraw(0, 128, 40, frames[0], true), timeBitmapDraw(0, 128, 40, frames[1], false)};
+  ssd1306_clearScreen();
+
+  const char *const sizes[2] = {"48x48", "128x40"};
+  const unsigned long *times[2] = {iconTimes, frameTimes};
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    Serial.print("Bitmap ");
+    Serial.print(sizes[i]);
+    Serial.print(": ");
+    Serial.print(times[i][0]);
+    Serial.print("us compressed, ");
+    Serial.print(times[i][1]);
+    Serial.println("us uncompressed");
+  }
+#endif
 }
 
 void showCurrentMixerVolume()
 {
+  if (!displayReady)
+    return; // The encoders are already running while the display is initialized
+
   // show the current mixer icon at the
   // show the other mixer icons at the left and right side of the display
   // show the current volume levels of the mixer at the bottom of the display
@@ -281,37 +820,62 @@ void showCurrentMixerVolume()
 
   // if no mixer icon was recently drawn, we need to clear the display
   if (lastMixerIndex == 255)
+  {
     ssd1306_clearScreen();
+    shownVolumeDigitCount = 0; // The volume readout was cleared as well
+  }
 
   // if no mixer icon is currently drawn or the mixer index changed, we need to redraw the icons
   if (currentMixerIndex != lastMixerIndex)
   {
-    uint8_t otherIcons[4] = {0, 1, 2, 3}; // Array to hold the other mixer icons
+    // the 4 nearest neighbours of the current mixer, the previous ones on the left and the next ones on the right
+    // the neighbours wrap around, so every mixer can be reached no matter how many there are
+    const int8_t neighbourOffsets[4] = {-2, -1, 1, 2};
+    const uint8_t neighbourX[4] = {0, 0, 103, 103};
+    const uint8_t neighbourPages[4] = {0, 5, 0, 5};
     for (uint8_t i = 0; i < 4; i++)
     {
-      if (otherIcons[i] >= centerIcon) // If the current icon is greater than or equal to the center icon, increment it
-      {
-        otherIcons[i]++;
-      }
+      int8_t offset = neighbourOffsets[i];
+      if (offset < 0 ? -offset > (NUM_MIXERS - 1) / 2 : offset > NUM_MIXERS / 2)
+        continue; // With fewer than 5 mixers a neighbour would be shown twice
+      uint8_t neighbour = (centerIcon + NUM_MIXERS + offset) % NUM_MIXERS;
+      drawStoredBitmap(neighbourX[i], neighbourPages[i], 24, 24, smallIcons[neighbour], SMALL_ICONS_COMPRESSED);
     }
-    ssd1306_drawBitmap(0, 0, 24, 24, smallIcons[otherIcons[0]]);
-    ssd1306_drawBitmap(0, 5, 24, 24, smallIcons[otherIcons[1]]);
-    ssd1306_drawBitmap(103, 0, 24, 24, smallIcons[otherIcons[2]]);
-    ssd1306_drawBitmap(103, 5, 24, 24, smallIcons[otherIcons[3]]);
     // Show the current mixer icon in the center of the display
-    ssd1306_drawBitmap(39, 0, 48, 48, largeIcons[centerIcon]);
+    drawStoredBitmap(39, 0, 48, 48, largeIcons[centerIcon], LARGE_ICONS_COMPRESSED);
   }
   // update the shown volume
-  uint8_t volume = volumeLevels[centerIcon]; // Get the current volume level of the selected mixer
-  uint8_t volumexPos = 63 - getNumberOfDigits(volume) * 6;
-  char volumeStr[4];
-  itoa(volume, volumeStr, 10);                                        // Convert the volume level to a string
-  if (getNumberOfDigits(lastVolumeLevel) > getNumberOfDigits(volume)) // If the last volume level was a character larger than the current, clear the area around the volume level
+  drawVolumeDigits(volumeLevels[centerIcon]);
+}
+
+void drawVolumeDigits(uint8_t volume)
+{
+  uint8_t digitCount = getNumberOfDigits(volume);
+  uint8_t digits[VOLUME_MAX_DIGITS];
+  for (int8_t i = digitCount - 1; i >= 0; i--) // Split the volume level into its digits, most significant first
+  {
+    digits[i] = volume % 10;
+    volume /= 10;
+  }
+
+  if (digitCount != shownVolumeDigitCount) // The readout is centered, so all cells move if the number of digits changes
+  {
+    if (shownVolumeDigitCount > digitCount) // Clear the area of the old readout if it was wider than the new one
+      ssd1306_clearBlock(VOLUME_CENTER_X - shownVolumeDigitCount * VOLUME_DIGIT_WIDTH / 2, VOLUME_PAGE, shownVolumeDigitCount * VOLUME_DIGIT_WIDTH, VOLUME_DIGIT_HEIGHT);
+    shownVolumeDigitCount = 0; // Force every cell to be redrawn
+  }
+
+  uint8_t xPosition = VOLUME_CENTER_X - digitCount * VOLUME_DIGIT_WIDTH / 2;
+  for (uint8_t i = 0; i < digitCount; i++)
   {
-    ssd1306_clearBlock(45, 6, 36, 16);
+    if (shownVolumeDigitCount == 0 || shownVolumeDigits[i] != digits[i]) // Only redraw the cells that changed
+    {
+      ssd1306_drawBitmap(xPosition, VOLUME_PAGE, VOLUME_DIGIT_WIDTH, VOLUME_DIGIT_HEIGHT, volumeDigits[digits[i]]);
+      shownVolumeDigits[i] = digits[i];
+    }
+    xPosition += VOLUME_DIGIT_WIDTH;
   }
-  ssd1306_printFixedN(volumexPos, 55, volumeStr, EFontStyle::STYLE_NORMAL, 1);
-  lastVolumeLevel = volume; // Update the last volume level to the current one
+  shownVolumeDigitCount = digitCount;
 }
 
 uint8_t getNumberOfDigits(uint8_t number)
@@ -327,49 +891,114 @@ uint8_t getNumberOfDigits(uint8_t number)
 }
 
 void sendVolumeLevelsToSerial()
+{
+  EVERY_N_MILLISECONDS(DEEJ_UPDATE_INTERVAL)
+  {
+    printVolumeLevels();
+  }
+}
+
+void printVolumeLevels(Print &output)
 {
   // Create a string with the volume levels of all mixers
   // It consists of the volume levels (from 0 to 1023), separated by a pipe character 
-
-  EVERY_N_MILLISECONDS(DEEJ_UPDATE_INTERVAL)
+  String volumeString = "";
+  for (uint8_t i = 0; i < NUM_MIXERS; i++)
   {
-    String volumeString = "";
-    for (uint8_t i = 0; i < NUM_MIXERS; i++)
+    int volume = isMuted[i] ? 0 : volumeLevels[i]; // If the mixer is muted, set the volume to 0
+    volume = map(volume, 0, 100, 0, 1023); // Map the volume level from 0-100% to 0-1023
+    volumeString += String(volume); 
+    if (i < NUM_MIXERS - 1)
     {
-      int volume = isMuted[i] ? 0 : volumeLevels[i]; // If the mixer is muted, set the volume to 0
-      volume = map(volume, 0, 100, 0, 1023); // Map the volume level from 0-100% to 0-1023
-      volumeString += String(volume); 
-      if (i < NUM_MIXERS - 1)
-      {
-        volumeString += "|"; // Add a pipe character between the volume levels
-      }
+      volumeString += "|"; // Add a pipe character between the volume levels
     }
-    Serial.println(volumeString); // Send the volume levels to the serial port
   }
+  output.println(volumeString); // Send the volume levels to the serial port
 }
 
-void setup()
+void initDisplayStep()
 {
-  updateLastActivityTime(false); // Initialize the last activity time
+  unsigned long stepStartTime = micros();
+  if (displayInitStep == 0)
+  {
+    sh1106_128x64_i2c_init(); // Initialize the OLED display
+    ssd1306_setFixedFont(ssd1306xled_font6x8);
+  }
+  else
+  {
+    ssd1306_clearBlock(0, displayInitStep - 1, OLED_WIDTH, 8); // Clear one page of the OLED display
+  }
+  unsigned long stepTime = micros() - stepStartTime;
+  if (stepTime > maxDisplayInitStepTime)
+    maxDisplayInitStepTime = stepTime;
 
-  pinMode(LED_PIN, OUTPUT); // Set the LED pin as output
+  if (++displayInitStep > OLED_HEIGHT / 8) // The init step and one step per page
+    displayReady = true;
+}
+
+void reportBootTimes()
+{
+#if BOOT_TIMING_REPORT
+  const char *const bootPhaseNames[NUM_BOOT_PHASES] = {"serial", "first frame", "leds", "inputs", "display"};
+  for (uint8_t i = 0; i < NUM_BOOT_PHASES; i++)
+  {
+    Serial.print("Boot ");
+    Serial.print(bootPhaseNames[i]);
+    Serial.print(": ");
+    Serial.print(bootPhaseTimes[i]);
+    Serial.println("us");
+  }
+  Serial.print("Boot longest display step: ");
+  Serial.print(maxDisplayInitStepTime);
+  Serial.println("us");
+#endif
+}
 
-  initButtons();  // Initialize the buttons
-  initEncoders(); // Initialize the encoders
-  initEEPROM();   // Initialize the eeprom
-  initMixers();   // Initialize the mixers and LEDs
+#ifndef PIO_UNIT_TESTING // The tests under test/ bring their own setup() and loop()
+void setup()
+{
+  // the host gets the volume levels first, then the LEDs show them
+  // the display takes the longest and is initialized in steps by the first loops
+  Serial.begin(SERIAL_BAUD_RATE); // Initialize serial communication for deej
+  bootPhaseTimes[BOOT_SERIAL] = micros();
 
-  sh1106_128x64_i2c_init(); // Initialize the OLED display
-  ssd1306_setFixedFont(ssd1306xled_font6x8);
-  ssd1306_clearScreen(); // Clear the OLED display
+  initEEPROM();        // Initialize the eeprom
+  fetchEEPROMData();   // Fetch the volume levels and mute states from the eeprom
+  printVolumeLevels(); // Send the stored volume levels, the serial buffer sends them while the rest boots
+  bootPhaseTimes[BOOT_FIRST_FRAME] = micros();
 
-  Serial.begin(9600); // Initialize serial communication for debugging
+  pinMode(LED_PIN, OUTPUT); // Set the LED pin as output
+  initMixers();             // Initialize the mixers and LEDs
+  bootPhaseTimes[BOOT_LEDS] = micros();
+
+  updateLastActivityTime(false); // Initialize the last activity time
+  initButtons();                 // Initialize the buttons
+  initEncoders();                // Initialize the encoders
+  bootPhaseTimes[BOOT_INPUTS] = micros();
 }
 
 void loop()
 {
+  scanEncoders(); // Read all encoder pins
+  if (deepIdleActive && pinChangeWake)
+    exitDeepIdle(); // Turn the LEDs back on before the encoder change is shown
   checkEncoders(); // Check the encoders for changes and update the volume levels and mute states accordingly
   checkButtons();  // Check the buttons for changes and act accordingly
   checkIdle();     // Check if the sound mixer is idle and take appropriate actions
   sendVolumeLevelsToSerial(); // Send the current volume levels of all mixers to the serial port for deej to read
+
+  if (!displayReady) // The rest of the sound mixer is running, so the display can be initialized now
+  {
+    initDisplayStep();
+    if (displayReady)
+    {
+      bootPhaseTimes[BOOT_DISPLAY] = micros();
+      reportBootTimes();
+      reportBitmapTimes();
+    }
+  }
+
+  if (deepIdleActive)
+    sleepUntilNextInterrupt(); // Sleep until the next timer tick, encoder change or serial data
 }
+#endif // PIO_UNIT_TESTING
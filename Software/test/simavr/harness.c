@@ -0,0 +1,415 @@
+/* SoundMixer firmware harness for simavr
+ * Runs the unmodified firmware image of the nanoatmega328 environment on a simulated ATmega328P and checks it from
+ * the outside, no test code is linked into the image:
+ *   - the uart is captured, the first line has to be the deej line of a fresh eeprom
+ *   - the encoder of the first mixer is turned one detent by driving its pins, the deej line has to follow
+ *   - the WS2812 data of every lane is decoded from the pin changes, so the bit timing, the gaps between the LEDs,
+ *     the transfer time of a frame and the LED colors are measured independently of the firmware's own timers
+ * The display is a stub that acknowledges every i2c byte sent to it, the buttons are held released.
+ * The harness assumes the direct encoder wiring and the first mixer as the first ring of the first lane.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "avr_adc.h"
+#include "avr_ioport.h"
+#include "avr_twi.h"
+#include "avr_uart.h"
+#include "sim_avr.h"
+#include "sim_elf.h"
+
+#include "defines.h"
+
+#if ENCODER_INPUT_SHIFT_REGISTER
+#error "The harness only drives the direct encoder inputs"
+#endif
+
+#define CPU_FREQUENCY 16000000
+#define CYCLES_PER_US (CPU_FREQUENCY / 1000000)
+#define LED_RESET_CYCLES (50 * CYCLES_PER_US) // WS2812 latch a frame after the line was low this long
+#define ZERO_HIGH_MAX 8                       // in cycles, 0 bits are high for 200 to 500ns
+#define ONE_HIGH_MIN 9                        // in cycles, 1 bits are high for 550 to 1000ns
+#define ONE_HIGH_MAX 16
+#define MAX_LANES 6
+#define MAX_LANE_LEDS (NUM_MIXERS * LEDS_PER_MIXER)
+#define MAX_LINES 256
+#define MAX_LINE_LENGTH 64
+#define DISPLAY_ADDRESS 0x3C
+#define BUTTON_RELEASED_VOLTAGE 5000 // in millivolts, analogRead() reads 1023
+#define TURN_TIME 1500               // in milliseconds, when the encoder of the first mixer is turned
+#define TURN_STEP_TIME 2             // in milliseconds, between two pin changes of the encoder
+#define DEFAULT_RUN_TIME 3000        // in milliseconds
+
+// wiring of the direct encoder inputs (A, B, switch), same as encoderPins in main.h
+static const uint8_t encoderPins[][3] = {
+    {13, 14, 12}, // Master
+    {16, 17, 15}, // Discord
+    {4, 5, 3},    // Spotify
+    {7, 8, 6},    // Chrome
+    {10, 11, 9}   // Games
+};
+_Static_assert(sizeof(encoderPins) / sizeof(encoderPins[0]) == NUM_MIXERS, "encoderPins needs the pins of each mixer");
+
+// one counter-clockwise detent, the firmware counts both edges of A, so the volume drops by 2 * VOLUME_STEP
+static const struct
+{
+  uint8_t input; // 0 for A, 1 for B
+  uint8_t level;
+} turnSteps[] = {{1, 0}, {0, 0}, {1, 1}, {0, 1}};
+#define NUM_TURN_STEPS (sizeof(turnSteps) / sizeof(turnSteps[0]))
+
+// decoder state of one LED lane
+struct Lane
+{
+  char port;
+  uint8_t bit;
+  uint8_t level;
+  avr_cycle_count_t riseCycle;
+  avr_cycle_count_t fallCycle;
+  bool inFrame;
+  avr_cycle_count_t frameStartCycle;
+  uint32_t bitCount;                // bits of the current frame
+  uint8_t bytes[MAX_LANE_LEDS * 3]; // data of the current frame in the order it was sent
+  avr_cycle_count_t frameGapCycles; // longest low time between two LEDs of the current frame
+
+  // results of the complete frames
+  uint32_t frames;
+  uint32_t firstFrameLEDs;
+  uint32_t brokenFrames; // Frames with a different number of LEDs than the first one
+  uint32_t bitErrors;    // High times that are neither a valid 0 nor a valid 1
+  avr_cycle_count_t maxGapCycles;
+  avr_cycle_count_t maxTransferCycles;
+  uint8_t firstFrame[MAX_LANE_LEDS * 3];
+  uint8_t lastFrame[MAX_LANE_LEDS * 3];
+};
+
+static avr_t *avr;
+static struct Lane lanes[MAX_LANES];
+static int numLanes;
+
+static char lines[MAX_LINES][MAX_LINE_LENGTH];
+static avr_cycle_count_t lineCycles[MAX_LINES];
+static int numLines;
+static char lineBuffer[MAX_LINE_LENGTH];
+static int lineLength;
+
+static bool displaySelected;
+static uint32_t displayBytes;
+
+static void arduinoPin(uint8_t pin, char *port, uint8_t *bit)
+{
+  if (pin < 8)
+  {
+    *port = 'D';
+    *bit = pin;
+  }
+  else if (pin < 14)
+  {
+    *port = 'B';
+    *bit = pin - 8;
+  }
+  else
+  {
+    *port = 'C';
+    *bit = pin - 14;
+  }
+}
+
+static void drivePin(uint8_t pin, uint8_t level)
+{
+  char port;
+  uint8_t bit;
+  arduinoPin(pin, &port, &bit);
+  avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(port), bit), level);
+}
+
+static void uartOutput(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+  (void)irq;
+  (void)param;
+  if (value == '\r')
+    return;
+  if (value != '\n')
+  {
+    if (lineLength < MAX_LINE_LENGTH - 1)
+      lineBuffer[lineLength++] = value;
+    return;
+  }
+  lineBuffer[lineLength] = 0;
+  if (numLines < MAX_LINES)
+  {
+    strcpy(lines[numLines], lineBuffer);
+    lineCycles[numLines++] = avr->cycle;
+  }
+  if (strchr(lineBuffer, '|') == NULL) // Reports of the firmware, the volume lines would flood the output
+    printf("uart: %s\n", lineBuffer);
+  lineLength = 0;
+}
+
+static void displayInput(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+  (void)irq;
+  (void)param;
+  avr_twi_msg_irq_t message;
+  message.u.v = value;
+  if (message.u.twi.msg & TWI_COND_START)
+    displaySelected = (message.u.twi.addr >> 1) == DISPLAY_ADDRESS;
+  if (displaySelected && (message.u.twi.msg & (TWI_COND_START | TWI_COND_WRITE)))
+  {
+    if (message.u.twi.msg & TWI_COND_WRITE)
+      displayBytes++;
+    avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_INPUT), avr_twi_irq_msg(TWI_COND_ACK, message.u.twi.addr, 1));
+  }
+  if (message.u.twi.msg & TWI_COND_STOP)
+    displaySelected = false;
+}
+
+static void finishFrame(struct Lane *lane)
+{
+  lane->inFrame = false;
+  uint32_t leds = lane->bitCount / 24;
+  if (lane->frames == 0)
+  {
+    lane->firstFrameLEDs = leds;
+    memcpy(lane->firstFrame, lane->bytes, leds * 3);
+  }
+  else if (leds != lane->firstFrameLEDs || lane->bitCount % 24 != 0)
+  {
+    lane->brokenFrames++; // Latched in the middle of a frame
+  }
+  memcpy(lane->lastFrame, lane->bytes, leds * 3);
+  lane->frames++;
+  if (lane->frameGapCycles > lane->maxGapCycles)
+    lane->maxGapCycles = lane->frameGapCycles;
+  if (lane->fallCycle - lane->frameStartCycle > lane->maxTransferCycles)
+    lane->maxTransferCycles = lane->fallCycle - lane->frameStartCycle;
+}
+
+static void lanePinChange(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+  (void)irq;
+  struct Lane *lane = param;
+  avr_cycle_count_t now = avr->cycle;
+  if (value == lane->level)
+    return;
+  lane->level = value;
+
+  if (value) // Rising edge, the start of a bit
+  {
+    if (lane->inFrame && now - lane->fallCycle >= LED_RESET_CYCLES)
+      finishFrame(lane);
+    if (!lane->inFrame)
+    {
+      lane->inFrame = true;
+      lane->frameStartCycle = now;
+      lane->bitCount = 0;
+      lane->frameGapCycles = 0;
+    }
+    else if (lane->bitCount % 24 == 0 && now - lane->fallCycle > lane->frameGapCycles)
+    {
+      lane->frameGapCycles = now - lane->fallCycle; // Low time between the last bit of an LED and the next LED
+    }
+    lane->riseCycle = now;
+    return;
+  }
+
+  // falling edge, the high time tells the bit
+  avr_cycle_count_t high = now - lane->riseCycle;
+  bool one = high >= ONE_HIGH_MIN;
+  if (high > ONE_HIGH_MAX || (high > ZERO_HIGH_MAX && high < ONE_HIGH_MIN))
+    lane->bitErrors++;
+  if (lane->bitCount < MAX_LANE_LEDS * 24)
+  {
+    uint8_t *byte = &lane->bytes[lane->bitCount / 8];
+    *byte = (*byte << 1) | one;
+  }
+  lane->bitCount++;
+  lane->fallCycle = now;
+}
+
+static bool parseLanes(const char *list)
+{
+  // a comma separated list of port pins like D2,D3
+  while (*list && numLanes < MAX_LANES)
+  {
+    if (list[0] < 'B' || list[0] > 'D' || list[1] < '0' || list[1] > '7')
+      return false;
+    lanes[numLanes].port = list[0];
+    lanes[numLanes].bit = list[1] - '0';
+    numLanes++;
+    list += 2;
+    if (*list == ',')
+      list++;
+  }
+  return *list == 0;
+}
+
+static uint32_t litLEDs(const uint8_t *frame)
+{
+  // LEDs of the first ring that are not black
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < LEDS_PER_MIXER; i++)
+  {
+    if (frame[i * 3] || frame[i * 3 + 1] || frame[i * 3 + 2])
+      count++;
+  }
+  return count;
+}
+
+static void volumeLine(char *line, int masterVolume)
+{
+  // the deej line of all mixers at 100% except the first one, mapped to 0 to 1023 like printVolumeLevels()
+  sprintf(line, "%d", masterVolume * 1023 / 100);
+  for (int i = 1; i < NUM_MIXERS; i++)
+  {
+    strcat(line, "|1023");
+  }
+}
+
+static bool check(bool passed, const char *what)
+{
+  printf("%-42s %s\n", what, passed ? "ok" : "FAILED");
+  return passed;
+}
+
+static void usage(const char *program)
+{
+  fprintf(stderr,
+          "usage: %s [-l lanes] [-t milliseconds] firmware.elf\n"
+          "  -l  port pins of the LED lanes, default D2 (LED_PIN), e.g. D2,D3,D4 for 3 lanes\n"
+          "  -t  simulated time, default %d\n",
+          program, DEFAULT_RUN_TIME);
+}
+
+int main(int argc, char **argv)
+{
+  const char *laneList = "D2";
+  int runTime = DEFAULT_RUN_TIME;
+  int option;
+  while ((option = getopt(argc, argv, "l:t:h")) != -1)
+  {
+    switch (option)
+    {
+    case 'l': laneList = optarg; break;
+    case 't': runTime = atoi(optarg); break;
+    default: usage(argv[0]); return option == 'h' ? 0 : 1;
+    }
+  }
+  if (optind != argc - 1 || !parseLanes(laneList) || numLanes == 0 || runTime <= TURN_TIME + 500)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  elf_firmware_t firmware = {0};
+  if (elf_read_firmware(argv[optind], &firmware) != 0)
+  {
+    fprintf(stderr, "can't read %s\n", argv[optind]);
+    return 1;
+  }
+  avr = avr_make_mcu_by_name("atmega328p");
+  if (!avr)
+  {
+    fprintf(stderr, "simavr has no atmega328p\n");
+    return 1;
+  }
+  avr_init(avr);
+  avr->frequency = CPU_FREQUENCY;
+  avr->vcc = avr->avcc = avr->aref = 5000;
+  avr_load_firmware(avr, &firmware);
+
+  // capture the uart instead of printing it
+  uint32_t uartFlags = 0;
+  avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &uartFlags);
+  uartFlags &= ~AVR_UART_FLAG_STDIO;
+  avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &uartFlags);
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), uartOutput, NULL);
+
+  avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_OUTPUT), displayInput, NULL);
+  for (int i = 0; i < numLanes; i++)
+  {
+    avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(lanes[i].port), lanes[i].bit), lanePinChange, &lanes[i]);
+  }
+
+  // the encoders rest with all pins high, the buttons are released
+  for (int i = 0; i < NUM_MIXERS; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      drivePin(encoderPins[i][j], 1);
+    }
+  }
+  avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_ADC6), BUTTON_RELEASED_VOLTAGE);
+  avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_ADC7), BUTTON_RELEASED_VOLTAGE);
+
+  avr_cycle_count_t turnCycle = (avr_cycle_count_t)TURN_TIME * CYCLES_PER_US * 1000;
+  avr_cycle_count_t stepCycles = (avr_cycle_count_t)TURN_STEP_TIME * CYCLES_PER_US * 1000;
+  avr_cycle_count_t runCycles = (avr_cycle_count_t)runTime * CYCLES_PER_US * 1000;
+  unsigned turnStep = 0;
+  int turnLine = -1; // First uart line after the encoder was turned
+  while (avr->cycle < runCycles)
+  {
+    int state = avr_run(avr);
+    if (state == cpu_Done || state == cpu_Crashed)
+    {
+      fprintf(stderr, "the firmware stopped at %.3f ms\n", avr->cycle / (CYCLES_PER_US * 1000.0));
+      break;
+    }
+    if (turnStep < NUM_TURN_STEPS && avr->cycle >= turnCycle + turnStep * stepCycles)
+    {
+      drivePin(encoderPins[0][turnSteps[turnStep].input], turnSteps[turnStep].level);
+      if (++turnStep == NUM_TURN_STEPS)
+        turnLine = numLines;
+    }
+    for (int i = 0; i < numLanes; i++)
+    {
+      if (lanes[i].inFrame && !lanes[i].level && avr->cycle - lanes[i].fallCycle >= LED_RESET_CYCLES)
+        finishFrame(&lanes[i]);
+    }
+  }
+
+  // results
+  char expectedLine[MAX_LINE_LENGTH];
+  int turnedVolume = 100 - 2 * VOLUME_STEP;
+  printf("uart lines:               %d\n", numLines);
+  printf("display bytes:            %u\n", displayBytes);
+  for (int i = 0; i < numLanes; i++)
+  {
+    struct Lane *lane = &lanes[i];
+    printf("lane %c%u:                  %u frames of %u LEDs, transfer %.1f us, longest gap between LEDs %.2f us, %u bit errors\n",
+           lane->port, lane->bit, lane->frames, lane->firstFrameLEDs, lane->maxTransferCycles / (double)CYCLES_PER_US,
+           lane->maxGapCycles / (double)CYCLES_PER_US, lane->bitErrors);
+  }
+
+  bool passed = true;
+  volumeLine(expectedLine, 100);
+  passed &= check(numLines > 0 && strcmp(lines[0], expectedLine) == 0, "first deej line of a fresh eeprom");
+  volumeLine(expectedLine, turnedVolume);
+  int changedLine = -1;
+  for (int i = turnLine < 0 ? numLines : turnLine; i < numLines && changedLine < 0; i++)
+  {
+    if (strcmp(lines[i], expectedLine) == 0)
+      changedLine = i;
+  }
+  passed &= check(changedLine >= 0 && strcmp(lines[numLines - 1], expectedLine) == 0, "deej line after turning the encoder");
+  if (changedLine >= 0)
+    printf("encoder to deej latency:  %.1f ms\n", (lineCycles[changedLine] - turnCycle - (NUM_TURN_STEPS - 1) * stepCycles) / (CYCLES_PER_US * 1000.0));
+  passed &= check(displayBytes > 0, "display initialized");
+
+  for (int i = 0; i < numLanes; i++)
+  {
+    struct Lane *lane = &lanes[i];
+    passed &= check(lane->frames > 0 && lane->firstFrameLEDs % LEDS_PER_MIXER == 0 && lane->brokenFrames == 0,
+                    "every frame has whole rings");
+    passed &= check(lane->bitErrors == 0, "WS2812 bit timing");
+    passed &= check(lane->maxGapCycles < LED_RESET_CYCLES, "gaps between LEDs below the reset time");
+  }
+  passed &= check(litLEDs(lanes[0].firstFrame) == LEDS_PER_MIXER, "first frame shows the first ring at 100%");
+  passed &= check(litLEDs(lanes[0].lastFrame) == (uint32_t)turnedVolume * LEDS_PER_MIXER / 100, "last frame shows the turned encoder");
+  return passed ? 0 : 1;
+}
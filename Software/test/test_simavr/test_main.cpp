@@ -0,0 +1,109 @@
+/* Firmware tests for the simavr environment, run with `pio test -e simavr`
+ * The firmware sources are linked in without their setup() and loop().
+ * main.h defines the globals of the firmware, so the parts under test are declared here instead.
+ */
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <FastLED.h>
+#include <unity.h>
+#include "defines.h"
+
+#define WS2812_BIT_CYCLES 20  // 1.25us at 16MHz
+#define WS2812_LED_TIME 30    // in microseconds, 24 bits
+#define WS2812_RESET_TIME 50  // in microseconds, the LEDs latch a frame once the line is low this long
+#define SEND_CALL_CYCLES 16   // cycles allowed for calling sendLEDBits() and reading the timer
+
+// firmware functions and globals under test
+extern CRGB leds[NUM_MIXERS * LEDS_PER_MIXER];
+extern uint8_t maxLEDInterruptLatency;
+extern uint16_t maxLEDGap;
+extern unsigned long ledFrameTime;
+void initEEPROM();
+void fetchEEPROMData();
+void initMixers();
+void showLEDsChunked();
+void sendLEDBits(volatile uint8_t *port, uint8_t hi, uint8_t lo, const uint8_t *bits);
+void printVolumeLevels(Print &output);
+
+// collects printed characters, so a line sent to deej can be checked
+class PrintCapture : public Print
+{
+public:
+  char text[64] = {0};
+  uint8_t length = 0;
+
+  size_t write(uint8_t value) override
+  {
+    if (length >= sizeof(text) - 1)
+      return 0; // Keep the terminating 0
+    text[length++] = value;
+    return 1;
+  }
+};
+
+void test_first_deej_line()
+{
+  // an eeprom without the layout header gets the defaults, all mixers at 100% and not muted
+  EEPROM.write(0, 0xFF);
+  initEEPROM();
+  fetchEEPROMData();
+
+  PrintCapture capture;
+  printVolumeLevels(capture);
+  TEST_ASSERT_EQUAL_STRING("1023|1023|1023|1023|1023\r\n", capture.text);
+}
+
+void test_ws2812_bit_timing()
+{
+  // timer1 counts cpu cycles, every bit has to take the same time no matter if it is a 0 or a 1
+  volatile uint8_t *port = portOutputRegister(digitalPinToPort(LED_PIN));
+  uint8_t mask = digitalPinToBitMask(LED_PIN);
+  uint8_t bits[24];
+  for (uint8_t i = 0; i < 24; i++)
+  {
+    bits[i] = (i & 1) ? mask : 0;
+  }
+  pinMode(LED_PIN, OUTPUT);
+
+  noInterrupts();
+  uint8_t lo = *port & ~mask;
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10); // No prescaler
+  TCNT1 = 0;
+  sendLEDBits(port, lo | mask, lo, bits);
+  uint16_t cycles = TCNT1;
+  interrupts();
+  TCCR1B = 0;
+
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT16(24 * WS2812_BIT_CYCLES - 1, cycles); // The last branch is not taken
+  TEST_ASSERT_LESS_OR_EQUAL_UINT16(24 * WS2812_BIT_CYCLES + SEND_CALL_CYCLES, cycles);
+}
+
+void test_ws2812_frame_timing()
+{
+  initMixers();
+  fill_solid(leds, NUM_MIXERS * LEDS_PER_MIXER, CRGB::White);
+  maxLEDGap = 0;
+  maxLEDInterruptLatency = 0;
+  showLEDsChunked();
+
+  // the gaps between the LEDs must not latch the LEDs in the middle of the frame
+  TEST_ASSERT_LESS_THAN_UINT16(WS2812_RESET_TIME, maxLEDGap);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT8(WS2812_LED_TIME + 4, maxLEDInterruptLatency); // Timer0 ticks every 4us
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(NUM_MIXERS * LEDS_PER_MIXER * (unsigned long)WS2812_LED_TIME, ledFrameTime);
+  TEST_ASSERT_LESS_THAN_UINT32(NUM_MIXERS * LEDS_PER_MIXER * (unsigned long)(WS2812_LED_TIME + WS2812_RESET_TIME), ledFrameTime);
+}
+
+void setup()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_first_deej_line);
+  RUN_TEST(test_ws2812_bit_timing);
+  RUN_TEST(test_ws2812_frame_timing);
+  UNITY_END();
+}
+
+void loop()
+{
+}